@@ -8,12 +8,15 @@
 #define TYPES_DECIMAL_H
 
 #include <iostream>
+#include <cassert>
 #include <deque>
+#include <functional>
 #include <vector>
 #include <cmath>
 #include <string>
 #include <sstream>
 #include <stdint.h>
+#include <utility>
 
 // Create an include file with this name, with the following line:
 // #define __EXPLICIT__ explicit
@@ -34,12 +37,16 @@
 
 class Decimal;
 class DecimalConstants;
+class DecimalModulus;
+class DecimalInt;
+class DecimalSeries;
 
 using xFD = Decimal;
 using xFDCon = DecimalConstants;
+using xFDInt = DecimalInt;
+using xFDSeries = DecimalSeries;
 
-static inline Decimal operator"" _D(unsigned long long x);
-static inline Decimal operator"" _D(long double x);
+template <char... Cs> inline const Decimal& operator"" _D();
 static inline Decimal operator"" _D(const char* x, size_t size);
 
 class DecimalIllegalOperation {
@@ -68,7 +75,9 @@ public:
     int Pi;
 
     // Number of Newton-Rhapson iterations to run on the reciprocal of the divisor during division.
-    // Zero disables the iterations.
+    // The reciprocal is seeded from the leading digits of the divisor, so more iterations are
+    // run when the precision needs them. Zero disables the iterations and takes the reciprocal
+    // from long division instead.
     // It is highly recommended to set this to a number greater than zero, because several unrelated
     // functions depend on the quotient being correct (e.g. Modulus & ToHex to give the correct
     // answer for enormous (>Abs(2^64)) numbers.
@@ -87,6 +96,8 @@ public:
     // This setting only affects special number generated when an exception
     // occurs (e.g. Divide/Mod by zero). Arithmetic between special numbers is
     // always done normally.
+    //
+    // Either way the failure raises one of the Decimal::StatusFlag flags.
     bool throw_on_error;
 
     bool TOE() const { return throw_on_error; }
@@ -107,6 +118,31 @@ public:
 };
 
 
+// Crossover sizes, in digits, at which the kernels switch algorithm.
+// The defaults suit a typical x86-64 host and are set in the library. Build
+// the `tuning` target to measure them on this machine: it writes
+// src/DecimalTuning.h, which the library picks up on its next build.
+
+class DecimalTuning {
+public:
+    // Products whose shorter operand has at least this many digits are
+    // computed by Karatsuba, below it by the schoolbook columns.
+    int karatsuba;
+
+    // Integer divisions whose divisor and quotient both have at least this
+    // many digits multiply by a Newton reciprocal instead of long division.
+    int newton_div;
+
+    // Transcendentals at up to this many decimals are first tried in long
+    // double, and up to double_double in double-double. Values past 15 and 30,
+    // the most those tiers can deliver, act as 15 and 30.
+    int hardware;
+    int double_double;
+
+    DecimalTuning();
+};
+
+
 /**
  * Implements an arbitrary-precision fixed-point decimal
  * with support for IEEE-754 special values
@@ -129,22 +165,105 @@ private:
     DecimalIterations iterations;
 
 
-    //Transformations int<-->char single digit
-    inline static int CharToInt(const char& val) { return (val - '0'); };
-    inline static char IntToChar(const int& val) {
-        if (val < 0 || val > 9) {
-            throw DecimalIllegalOperation("\"" + std::to_string(val) + "\" is not a valid decimal digit.");
-        }
+    //Transformations int<-->char single digit. The kernels only ever
+    //pass values they computed as digits.
+    inline static int CharToInt(const char& val) noexcept { return (val - '0'); };
+    inline static char IntToChar(const int& val) noexcept {
+        assert(val >= 0 && val <= 9);
         return (val + '0');
     };
 
+    //Raises `flags` in the thread's status, then throws `msg` if `toe` is
+    //set. Every failing operation goes through here, which keeps building
+    //the exception out of line and off the paths that don't fail.
+    static void Signal(unsigned flags, bool toe, const char* msg);
+    //Result of an integer conversion that doesn't fit, after signalling:
+    //0 for NaN, else the value rounded toward zero and clamped to T.
+    template <typename T> T ConversionFailure(const char* msg) const;
+
+    //The kernels below only see finite operands their callers checked, so
+    //nothing but std::bad_alloc can go wrong in them. Those that allocate
+    //let it through, the rest are noexcept.
+
     //Comparator without sign, utilized by Comparators and Operations
-    static int CompareNum(const Decimal& left, const Decimal& right);
+    static int CompareNum(const Decimal& left, const Decimal& right) noexcept;
 
     //Operations without sign and decimals, utilized by Operations
     static Decimal Sum(const Decimal& left, const Decimal& right);
     static Decimal Subtract(const Decimal& left, const Decimal& right);
     static Decimal Multiply(const Decimal& left, const Decimal& right);
+    static Decimal MultiplyTrunc(const Decimal& left, const Decimal& right, int cut);
+    static Decimal Square(const Decimal& x);
+    static void DivModNum(const Decimal& left, const Decimal& right, Decimal& quotient, Decimal& remainder);
+    static Decimal ISqrtNum(const Decimal& x, Decimal& remainder);
+
+    //Signed sum, or difference when `subtract` is set, of finite operands in
+    //a single pass that aligns the decimals by offset, utilized by operator+
+    //and operator-
+    static Decimal AddSigned(const Decimal& left, const Decimal& right, bool subtract);
+
+    //Karatsuba product without sign and decimals, utilized by Multiply and Square
+    static Decimal MultiplyKaratsuba(const Decimal& left, const Decimal& right);
+    //Approximation of 10^(digits(d)+p) / d within a few units, and the
+    //integer division built on it, utilized by DivModNum
+    static Decimal RecipNum(const Decimal& d, int p);
+    static void DivModNewton(const Decimal& left, const Decimal& right, Decimal& quotient, Decimal& remainder);
+
+    //Leading digits as mantissa * 10^exponent with 1 <= |mantissa| < 10, read
+    //on demand from the top 17 digits. False for zero and special numbers.
+    bool LeadApprox(double& mantissa, int& exponent) const noexcept;
+    //Decimal holding the 17 leading digits of v * 10^exponent, utilized to
+    //seed Newton iterations
+    static Decimal FromApprox(double v, int exponent, const DecimalIterations& its);
+
+    //Machine-integer right operands, utilized by the mixed operators. Each
+    //gives what the operator on Decimal(right) gives, without building it
+    //when the integer is below 10^18.
+    static unsigned long long Magnitude(long long v) noexcept {
+        return (v < 0) ? 0ULL - static_cast<unsigned long long>(v) : static_cast<unsigned long long>(v);
+    }
+    static Decimal FromInteger(unsigned long long magnitude, bool negative);
+    bool AddIntegerInPlace(unsigned long long magnitude, bool negative);
+    void AddSmallInPlace(unsigned long long magnitude, bool negative);
+    static Decimal AddSmall(const Decimal& left, unsigned long long magnitude, bool negative);
+    static Decimal MulSmall(const Decimal& left, unsigned long long magnitude, bool negative);
+    static Decimal DivSmall(const Decimal& left, unsigned long long magnitude, bool negative);
+    int CompareInteger(unsigned long long magnitude, bool negative) const;
+
+    //Product truncated to `places` decimals, utilized by series and Newton steps
+    static Decimal MulFixed(const Decimal& left, const Decimal& right, int places);
+    //Whether the rounded quotient q of left/right is exact, utilized by operator/
+    static bool ExactQuotient(const Decimal& left, const Decimal& right, const Decimal& q);
+
+#ifdef __SIZEOF_INT128__
+    //Native tier for operands of at most 38 digits, utilized by Operations.
+    //Each returns false, leaving `result` untouched, when the operands or
+    //the result don't fit.
+    static bool ToInt128(const Decimal& x, int decimals, unsigned __int128& magnitude) noexcept;
+    static Decimal FromInt128(unsigned __int128 magnitude, char sign, int decimals, const DecimalIterations& its);
+    static bool AddInt128(const Decimal& left, const Decimal& right, bool subtract, Decimal& result);
+    static bool MulInt128(const Decimal& left, const Decimal& right, Decimal& result);
+    static bool DivInt128(const Decimal& left, const Decimal& right, Decimal& result);
+#endif
+
+    //Hardware tier for transcendentals at low precision, utilized by the Math
+    //methods. False means the result isn't provably rounded right and the
+    //caller has to run the Decimal series.
+    static bool HardwareArg(const Decimal& x, long double& xl);
+    static bool HardwareRound(long double y, long double err, const DecimalIterations& its, Decimal& result);
+    static bool HardwareEval(long double (*f)(long double), const Decimal& x, Decimal& result);
+    static bool HardwareEval(long double (*f)(long double, long double), const Decimal& x, const Decimal& y, Decimal& result);
+
+    //Signed square through the Square kernel, utilized by the power methods
+    static Decimal Sqr(const Decimal& x);
+    //Left-to-right sliding window power for an integer n >= 0, reducing every
+    //step through `mod` unless it is null
+    static Decimal PowWindow(const Decimal& base, const Decimal& n, const DecimalModulus* mod);
+
+    friend class DecimalModulus;
+    friend class DecimalInt;
+    friend class DecimalSeries;
+    friend class DecimalConstants;
 
     void SpecialClear() {
         iterations = DecimalIterations();
@@ -153,6 +272,39 @@ private:
     }
 
 public:
+    // Rounding modes understood by RoundTo, named after their IEEE-754
+    // counterparts. HALF_UP breaks ties away from zero.
+    enum RoundingMode {
+        ROUND_HALF_EVEN,
+        ROUND_HALF_UP,
+        ROUND_DOWN,
+        ROUND_UP,
+        ROUND_FLOOR,
+        ROUND_CEILING
+    };
+
+    // IEEE-754 style status flags. A failing operation raises its flag
+    // whether or not it throws, and flags stay raised until cleared, so a
+    // batch run with throw_on_error disabled can check them once at the
+    // end instead of catching every operation. Each thread has its own.
+    //   STATUS_INVALID: the result is NaN, or the operands were outside
+    //     the domain of the operation.
+    //   STATUS_DIVISION_BY_ZERO: an exact infinity came out of finite
+    //     operands, e.g. x/0.
+    //   STATUS_OVERFLOW: the value doesn't fit the machine type it was
+    //     converted to.
+    //   STATUS_INEXACT: non-zero digits were rounded away.
+    enum StatusFlag {
+        STATUS_INVALID = 1,
+        STATUS_DIVISION_BY_ZERO = 2,
+        STATUS_OVERFLOW = 4,
+        STATUS_INEXACT = 8,
+        STATUS_ALL = 15
+    };
+    static unsigned GetStatus();
+    static bool TestStatus(unsigned flags);
+    static void ClearStatus(unsigned flags = STATUS_ALL);
+
     //Constructors
     Decimal() {
         sign='\0';
@@ -250,16 +402,29 @@ public:
     // Do NOT put a leading 0x or 0X.
     static Decimal FromHex(const std::string& hex);
 
+    // Numeric literal spelled as in C++ source, utilized by the _D literals.
+    // Floating literals keep at least 6 decimals.
+    static Decimal FromLiteral(const char* literal);
+
     static Decimal NaN() { return Decimal(); }
 
-    bool IsInf() const {
+    bool IsInf() const noexcept {
         return type == NumType::_INFINITY;
     }
 
-    bool IsNaN() const {
+    bool IsNaN() const noexcept {
         return type == NumType::_NAN;
     }
 
+    // Classification that reads the digits in place instead of comparing
+    // against a literal. Zero of either sign is zero and not negative,
+    // NaN is none of them.
+    bool IsZero() const noexcept;
+    bool IsNegative() const noexcept;
+    bool IsOne() const noexcept;
+    // Negative, zero or positive as *this is below, equal to or above v.
+    int CompareSmall(long long v) const;
+
     Decimal operator()(const DecimalIterations& _iterations = DecimalIterations()) const {
         Decimal a = *this;
         a.iterations = _iterations;
@@ -287,23 +452,23 @@ public:
     Decimal& operator=(long double Num);
 
     //Operations
-    friend Decimal operator+(const Decimal& left_, const Decimal& right_);
+    friend Decimal operator+(const Decimal& left, const Decimal& right);
     friend Decimal operator+(const Decimal& left, const char& right)
     { return left + Decimal(right); }
     friend Decimal operator+(const Decimal& left, const unsigned char& right)
     { return left + Decimal(right); }
     friend Decimal operator+(const Decimal& left, const short& right)
-    { return left + Decimal(right); }
+    { return Decimal::AddSmall(left, Decimal::Magnitude(right), right < 0); }
     friend Decimal operator+(const Decimal& left, const unsigned short& right)
-    { return left + Decimal(right); }
+    { return Decimal::AddSmall(left, right, false); }
     friend Decimal operator+(const Decimal& left, const int& right)
-    { return left + Decimal(right); }
+    { return Decimal::AddSmall(left, Decimal::Magnitude(right), right < 0); }
     friend Decimal operator+(const Decimal& left, const unsigned int& right)
-    { return left + Decimal(right); }
+    { return Decimal::AddSmall(left, right, false); }
     friend Decimal operator+(const Decimal& left, const long& right)
-    { return left + Decimal(right); }
+    { return Decimal::AddSmall(left, Decimal::Magnitude(right), right < 0); }
     friend Decimal operator+(const Decimal& left, const unsigned long& right)
-    { return left + Decimal(right); }
+    { return Decimal::AddSmall(left, right, false); }
     friend Decimal operator+(const Decimal& left, const float& right)
     { return left + Decimal(right); }
     friend Decimal operator+(const Decimal& left, const double& right)
@@ -324,27 +489,27 @@ public:
         return *this;
     }
     Decimal& operator+=(const short& right) {
-        *this = *this + Decimal(right);
+        AddSmallInPlace(Decimal::Magnitude(right), right < 0);
         return *this;
     }
     Decimal& operator+=(const unsigned short& right) {
-        *this = *this + Decimal(right);
+        AddSmallInPlace(right, false);
         return *this;
     }
     Decimal& operator+=(const int& right) {
-        *this = *this + Decimal(right);
+        AddSmallInPlace(Decimal::Magnitude(right), right < 0);
         return *this;
     }
     Decimal& operator+=(const unsigned int& right) {
-        *this = *this + Decimal(right);
+        AddSmallInPlace(right, false);
         return *this;
     }
     Decimal& operator+=(const long& right) {
-        *this = *this + Decimal(right);
+        AddSmallInPlace(Decimal::Magnitude(right), right < 0);
         return *this;
     }
     Decimal& operator+=(const unsigned long& right) {
-        *this = *this + Decimal(right);
+        AddSmallInPlace(right, false);
         return *this;
     }
     Decimal& operator+=(const float& right) {
@@ -360,23 +525,23 @@ public:
         return *this;
     }
 
-    friend Decimal operator-(const Decimal& left_, const Decimal& right_);
+    friend Decimal operator-(const Decimal& left, const Decimal& right);
     friend Decimal operator-(const Decimal& left, const char& right)
     { return left - Decimal(right); }
     friend Decimal operator-(const Decimal& left, const unsigned char& right)
     { return left - Decimal(right); }
     friend Decimal operator-(const Decimal& left, const short& right)
-    { return left - Decimal(right); }
+    { return Decimal::AddSmall(left, Decimal::Magnitude(right), right > 0); }
     friend Decimal operator-(const Decimal& left, const unsigned short& right)
-    { return left - Decimal(right); }
+    { return Decimal::AddSmall(left, right, right != 0); }
     friend Decimal operator-(const Decimal& left, const int& right)
-    { return left - Decimal(right); }
+    { return Decimal::AddSmall(left, Decimal::Magnitude(right), right > 0); }
     friend Decimal operator-(const Decimal& left, const unsigned int& right)
-    { return left - Decimal(right); }
+    { return Decimal::AddSmall(left, right, right != 0); }
     friend Decimal operator-(const Decimal& left, const long& right)
-    { return left - Decimal(right); }
+    { return Decimal::AddSmall(left, Decimal::Magnitude(right), right > 0); }
     friend Decimal operator-(const Decimal& left, const unsigned long& right)
-    { return left - Decimal(right); }
+    { return Decimal::AddSmall(left, right, right != 0); }
     friend Decimal operator-(const Decimal& left, const float& right)
     { return left - Decimal(right); }
     friend Decimal operator-(const Decimal& left, const double& right)
@@ -397,27 +562,27 @@ public:
         return *this;
     }
     Decimal& operator-=(const short& right) {
-        *this = *this - Decimal(right);
+        AddSmallInPlace(Decimal::Magnitude(right), right > 0);
         return *this;
     }
     Decimal& operator-=(const unsigned short& right) {
-        *this = *this - Decimal(right);
+        AddSmallInPlace(right, right != 0);
         return *this;
     }
     Decimal& operator-=(const int& right) {
-        *this = *this - Decimal(right);
+        AddSmallInPlace(Decimal::Magnitude(right), right > 0);
         return *this;
     }
     Decimal& operator-=(const unsigned int& right) {
-        *this = *this - Decimal(right);
+        AddSmallInPlace(right, right != 0);
         return *this;
     }
     Decimal& operator-=(const long& right) {
-        *this = *this - Decimal(right);
+        AddSmallInPlace(Decimal::Magnitude(right), right > 0);
         return *this;
     }
     Decimal& operator-=(const unsigned long& right) {
-        *this = *this - Decimal(right);
+        AddSmallInPlace(right, right != 0);
         return *this;
     }
     Decimal& operator-=(const float& right) {
@@ -439,17 +604,17 @@ public:
     friend Decimal operator*(const Decimal& left, const unsigned char& right)
     { return left * Decimal(right); }
     friend Decimal operator*(const Decimal& left, const short& right)
-    { return left * Decimal(right); }
+    { return Decimal::MulSmall(left, Decimal::Magnitude(right), right < 0); }
     friend Decimal operator*(const Decimal& left, const unsigned short& right)
-    { return left * Decimal(right); }
+    { return Decimal::MulSmall(left, right, false); }
     friend Decimal operator*(const Decimal& left, const int& right)
-    { return left * Decimal(right); }
+    { return Decimal::MulSmall(left, Decimal::Magnitude(right), right < 0); }
     friend Decimal operator*(const Decimal& left, const unsigned int& right)
-    { return left * Decimal(right); }
+    { return Decimal::MulSmall(left, right, false); }
     friend Decimal operator*(const Decimal& left, const long& right)
-    { return left * Decimal(right); }
+    { return Decimal::MulSmall(left, Decimal::Magnitude(right), right < 0); }
     friend Decimal operator*(const Decimal& left, const unsigned long& right)
-    { return left * Decimal(right); }
+    { return Decimal::MulSmall(left, right, false); }
     friend Decimal operator*(const Decimal& left, const float& right)
     { return left * Decimal(right); }
     friend Decimal operator*(const Decimal& left, const double& right)
@@ -457,6 +622,14 @@ public:
     friend Decimal operator*(const Decimal& left, const long double& right)
     { return left * Decimal(right); }
 
+    // Product truncated to at least `digits` significant digits. Only the
+    // partial products that reach those digits are computed, so the
+    // last digit may be one unit lower than the exact product's.
+    static Decimal MulTrunc(const Decimal& left, const Decimal& right, int digits);
+
+    // a*b + c computed exactly and rounded once to the working precision.
+    static Decimal Fma(const Decimal& a, const Decimal& b, const Decimal& c);
+
     Decimal& operator*=(const Decimal& right) {
         *this = *this * right;
         return *this;
@@ -470,27 +643,27 @@ public:
         return *this;
     }
     Decimal& operator*=(const short& right) {
-        *this = *this * Decimal(right);
+        *this = *this * right;
         return *this;
     }
     Decimal& operator*=(const unsigned short& right) {
-        *this = *this * Decimal(right);
+        *this = *this * right;
         return *this;
     }
     Decimal& operator*=(const int& right) {
-        *this = *this * Decimal(right);
+        *this = *this * right;
         return *this;
     }
     Decimal& operator*=(const unsigned int& right) {
-        *this = *this * Decimal(right);
+        *this = *this * right;
         return *this;
     }
     Decimal& operator*=(const long& right) {
-        *this = *this * Decimal(right);
+        *this = *this * right;
         return *this;
     }
     Decimal& operator*=(const unsigned long& right) {
-        *this = *this * Decimal(right);
+        *this = *this * right;
         return *this;
     }
     Decimal& operator*=(const float& right) {
@@ -512,17 +685,17 @@ public:
     friend Decimal operator/(const Decimal& left, const unsigned char& right)
     { return left / Decimal(right); }
     friend Decimal operator/(const Decimal& left, const short& right)
-    { return left / Decimal(right); }
+    { return Decimal::DivSmall(left, Decimal::Magnitude(right), right < 0); }
     friend Decimal operator/(const Decimal& left, const unsigned short& right)
-    { return left / Decimal(right); }
+    { return Decimal::DivSmall(left, right, false); }
     friend Decimal operator/(const Decimal& left, const int& right)
-    { return left / Decimal(right); }
+    { return Decimal::DivSmall(left, Decimal::Magnitude(right), right < 0); }
     friend Decimal operator/(const Decimal& left, const unsigned int& right)
-    { return left / Decimal(right); }
+    { return Decimal::DivSmall(left, right, false); }
     friend Decimal operator/(const Decimal& left, const long& right)
-    { return left / Decimal(right); }
+    { return Decimal::DivSmall(left, Decimal::Magnitude(right), right < 0); }
     friend Decimal operator/(const Decimal& left, const unsigned long& right)
-    { return left / Decimal(right); }
+    { return Decimal::DivSmall(left, right, false); }
     friend Decimal operator/(const Decimal& left, const float& right)
     { return left / Decimal(right); }
     friend Decimal operator/(const Decimal& left, const double& right)
@@ -543,27 +716,27 @@ public:
         return *this;
     }
     Decimal& operator/=(const short& right) {
-        *this = *this / Decimal(right);
+        *this = *this / right;
         return *this;
     }
     Decimal& operator/=(const unsigned short& right) {
-        *this = *this / Decimal(right);
+        *this = *this / right;
         return *this;
     }
     Decimal& operator/=(const int& right) {
-        *this = *this / Decimal(right);
+        *this = *this / right;
         return *this;
     }
     Decimal& operator/=(const unsigned int& right) {
-        *this = *this / Decimal(right);
+        *this = *this / right;
         return *this;
     }
     Decimal& operator/=(const long& right) {
-        *this = *this / Decimal(right);
+        *this = *this / right;
         return *this;
     }
     Decimal& operator/=(const unsigned long& right) {
-        *this = *this / Decimal(right);
+        *this = *this / right;
         return *this;
     }
     Decimal& operator/=(const float& right) {
@@ -582,6 +755,11 @@ public:
     static Decimal Divide(const Decimal& left, const Decimal& right);
     static Decimal Mod(const Decimal& left, const Decimal& right);
 
+    // Integer division truncated towards zero, computed in a single
+    // long-division pass. Returns the quotient and stores the remainder,
+    // which takes the sign of the dividend, in `remainder`.
+    static Decimal DivMod(const Decimal& left, const Decimal& right, Decimal& remainder);
+
     friend Decimal operator%(const Decimal& left, const Decimal& right);
     friend Decimal operator%(const Decimal& left, const char& right)
     { return left % Decimal(right); }
@@ -656,10 +834,10 @@ public:
     }
 
 
-    Decimal& operator++(int i) { *this = *this+1; return *this; };
-    Decimal& operator++() { *this = *this+1; return *this; };
-    Decimal& operator--(int i) { *this = *this-1; return *this; };
-    Decimal& operator--() { *this = *this-1; return *this; };
+    Decimal& operator++(int i) { AddSmallInPlace(1, false); return *this; };
+    Decimal& operator++() { AddSmallInPlace(1, false); return *this; };
+    Decimal& operator--(int i) { AddSmallInPlace(1, true); return *this; };
+    Decimal& operator--() { AddSmallInPlace(1, true); return *this; };
 
 
     //Comparators
@@ -669,17 +847,17 @@ public:
     bool operator== (const unsigned char& right) const
     {return *this == Decimal(right); }
     bool operator== (const short& right) const
-    {return *this == Decimal(right); }
+    {return type != NumType::_NAN && CompareInteger(Decimal::Magnitude(right), right < 0) == 0; }
     bool operator== (const unsigned short& right) const
-    {return *this == Decimal(right); }
+    {return type != NumType::_NAN && CompareInteger(right, false) == 0; }
     bool operator== (const int& right) const
-    {return *this == Decimal(right); }
+    {return type != NumType::_NAN && CompareInteger(Decimal::Magnitude(right), right < 0) == 0; }
     bool operator== (const unsigned int& right) const
-    {return *this == Decimal(right); }
+    {return type != NumType::_NAN && CompareInteger(right, false) == 0; }
     bool operator== (const long& right) const
-    {return *this == Decimal(right); }
+    {return type != NumType::_NAN && CompareInteger(Decimal::Magnitude(right), right < 0) == 0; }
     bool operator== (const unsigned long& right) const
-    {return *this == Decimal(right); }
+    {return type != NumType::_NAN && CompareInteger(right, false) == 0; }
     bool operator== (const float& right) const
     {return *this == Decimal(right); }
     bool operator== (const double& right) const
@@ -693,17 +871,17 @@ public:
     bool operator!= (const unsigned char& right) const
     {return *this != Decimal(right); }
     bool operator!= (const short& right) const
-    {return *this != Decimal(right); }
+    {return !(*this == right); }
     bool operator!= (const unsigned short& right) const
-    {return *this != Decimal(right); }
+    {return !(*this == right); }
     bool operator!= (const int& right) const
-    {return *this != Decimal(right); }
+    {return !(*this == right); }
     bool operator!= (const unsigned int& right) const
-    {return *this != Decimal(right); }
+    {return !(*this == right); }
     bool operator!= (const long& right) const
-    {return *this != Decimal(right); }
+    {return !(*this == right); }
     bool operator!= (const unsigned long& right) const
-    {return *this != Decimal(right); }
+    {return !(*this == right); }
     bool operator!= (const float& right) const
     {return *this != Decimal(right); }
     bool operator!= (const double& right) const
@@ -717,17 +895,17 @@ public:
     bool operator> (const unsigned char& right) const
     {return *this > Decimal(right); }
     bool operator> (const short& right) const
-    {return *this > Decimal(right); }
+    {return CompareInteger(Decimal::Magnitude(right), right < 0) > 0; }
     bool operator> (const unsigned short& right) const
-    {return *this > Decimal(right); }
+    {return CompareInteger(right, false) > 0; }
     bool operator> (const int& right) const
-    {return *this > Decimal(right); }
+    {return CompareInteger(Decimal::Magnitude(right), right < 0) > 0; }
     bool operator> (const unsigned int& right) const
-    {return *this > Decimal(right); }
+    {return CompareInteger(right, false) > 0; }
     bool operator> (const long& right) const
-    {return *this > Decimal(right); }
+    {return CompareInteger(Decimal::Magnitude(right), right < 0) > 0; }
     bool operator> (const unsigned long& right) const
-    {return *this > Decimal(right); }
+    {return CompareInteger(right, false) > 0; }
     bool operator> (const float& right) const
     {return *this > Decimal(right); }
     bool operator> (const double& right) const
@@ -741,17 +919,17 @@ public:
     bool operator>= (const unsigned char& right) const
     {return *this >= Decimal(right); }
     bool operator>= (const short& right) const
-    {return *this >= Decimal(right); }
+    {return CompareInteger(Decimal::Magnitude(right), right < 0) >= 0; }
     bool operator>= (const unsigned short& right) const
-    {return *this >= Decimal(right); }
+    {return CompareInteger(right, false) >= 0; }
     bool operator>= (const int& right) const
-    {return *this >= Decimal(right); }
+    {return CompareInteger(Decimal::Magnitude(right), right < 0) >= 0; }
     bool operator>= (const unsigned int& right) const
-    {return *this >= Decimal(right); }
+    {return CompareInteger(right, false) >= 0; }
     bool operator>= (const long& right) const
-    {return *this >= Decimal(right); }
+    {return CompareInteger(Decimal::Magnitude(right), right < 0) >= 0; }
     bool operator>= (const unsigned long& right) const
-    {return *this >= Decimal(right); }
+    {return CompareInteger(right, false) >= 0; }
     bool operator>= (const float& right) const
     {return *this >= Decimal(right); }
     bool operator>= (const double& right) const
@@ -765,17 +943,17 @@ public:
     bool operator< (const unsigned char& right) const
     {return *this < Decimal(right); }
     bool operator< (const short& right) const
-    {return *this < Decimal(right); }
+    {return CompareInteger(Decimal::Magnitude(right), right < 0) < 0; }
     bool operator< (const unsigned short& right) const
-    {return *this < Decimal(right); }
+    {return CompareInteger(right, false) < 0; }
     bool operator< (const int& right) const
-    {return *this < Decimal(right); }
+    {return CompareInteger(Decimal::Magnitude(right), right < 0) < 0; }
     bool operator< (const unsigned int& right) const
-    {return *this < Decimal(right); }
+    {return CompareInteger(right, false) < 0; }
     bool operator< (const long& right) const
-    {return *this < Decimal(right); }
+    {return CompareInteger(Decimal::Magnitude(right), right < 0) < 0; }
     bool operator< (const unsigned long& right) const
-    {return *this < Decimal(right); }
+    {return CompareInteger(right, false) < 0; }
     bool operator< (const float& right) const
     {return *this < Decimal(right); }
     bool operator< (const double& right) const
@@ -789,17 +967,17 @@ public:
     bool operator<= (const unsigned char& right) const
     {return *this <= Decimal(right); }
     bool operator<= (const short& right) const
-    {return *this <= Decimal(right); }
+    {return CompareInteger(Decimal::Magnitude(right), right < 0) <= 0; }
     bool operator<= (const unsigned short& right) const
-    {return *this <= Decimal(right); }
+    {return CompareInteger(right, false) <= 0; }
     bool operator<= (const int& right) const
-    {return *this <= Decimal(right); }
+    {return CompareInteger(Decimal::Magnitude(right), right < 0) <= 0; }
     bool operator<= (const unsigned int& right) const
-    {return *this <= Decimal(right); }
+    {return CompareInteger(right, false) <= 0; }
     bool operator<= (const long& right) const
-    {return *this <= Decimal(right); }
+    {return CompareInteger(Decimal::Magnitude(right), right < 0) <= 0; }
     bool operator<= (const unsigned long& right) const
-    {return *this <= Decimal(right); }
+    {return CompareInteger(right, false) <= 0; }
     bool operator<= (const float& right) const
     {return *this <= Decimal(right); }
     bool operator<= (const double& right) const
@@ -869,10 +1047,21 @@ public:
     std::string ToFixedString() const;
     std::string ToHex(bool lowercase=false) const;
 
+    const DecimalIterations& GetIterations() const { return iterations; }
+
+    // Algorithm crossovers shared by every Decimal. Changing them only
+    // affects speed, never results.
+    static DecimalTuning& Tuning();
     bool GetThrowOnError() const { return iterations.throw_on_error; }
     void SetThrowOnError(bool toe) { iterations.throw_on_error = toe; }
 
     void SetPrecision(int prec);    //Approximate number or Increase number decimals
+    // Rounds in place to `places` decimals, a negative value rounds to
+    // tens, hundreds and so on. Never adds decimals.
+    void RoundTo(int places, RoundingMode mode = ROUND_HALF_EVEN);
+    // Multiplies by 10^k in place, k may be negative. Only the decimal
+    // point moves: zeros are added where it passes the end of the digits.
+    void ShiftDecimalPoint(int k);
 
     void LeadTrim();    //Remove number leading zeros, utilized by Operations without sign
     void TrailTrim();     //Remove number non significant trailing zeros
@@ -881,18 +1070,27 @@ public:
     
     static Decimal Pow(const Decimal& x);
     static Decimal Pow(const Decimal& x, const Decimal& y);
+    // Exact base^n for an integer n. A negative n costs one reciprocal.
+    static Decimal IPow(const Decimal& base, const Decimal& n);
+    // base^e mod m for integers e >= 0 and m > 0.
+    static Decimal PowMod(const Decimal& base, const Decimal& e, const Decimal& m);
     static Decimal Ln(const Decimal& x);
     static Decimal Log(const Decimal& b, const Decimal& x);
     static Decimal Log10(const Decimal& x);
     static Decimal Log2(const Decimal& x);
 
-    Decimal operator^(const Decimal& x) {
+    Decimal operator^(const Decimal& x) const {
         return xFD::Pow(*this, x);
     }
 
-    static Decimal Sqrt(const Decimal& x) {
-        return xFD::Pow(x, 0.5_D);
-    }
+    // Square root truncated to iterations.decimals places.
+    static Decimal Sqrt(const Decimal& x);
+    // Reciprocal square root truncated to iterations.decimals places.
+    static Decimal RSqrt(const Decimal& x);
+    // Largest integer whose square is not greater than x. x must be a
+    // non-negative integer.
+    static Decimal ISqrt(const Decimal& x);
+    static bool IsSquare(const Decimal& x);
 
     static Decimal Sin(const Decimal& x);
     static Decimal Cos(const Decimal& x);
@@ -944,11 +1142,15 @@ public:
     static Decimal nPr(const Decimal& n, const Decimal& k);
     static Decimal nCr(const Decimal& n, const Decimal& k);
 
-    static Decimal Floor(const Decimal& x); 
-    static Decimal Ceil(const Decimal& x) {
-        return xFD::Floor(x) + 1_D;
-    }
-    static Decimal Round(const Decimal& x, int places = 0);
+    static Decimal Floor(const Decimal& x);
+    static Decimal Ceil(const Decimal& x);
+    // Rounds to a multiple of 10^places, so -2 keeps two decimals.
+    static Decimal Round(const Decimal& x, int places = 0, RoundingMode mode = ROUND_HALF_UP);
+    // Splits x into its integer part, stored in ipart, and its fraction,
+    // which is returned. Both carry the sign of x.
+    static Decimal Modf(const Decimal& x, Decimal& ipart);
+    // x * 10^k through ShiftDecimalPoint, exact for any k.
+    static Decimal ScaleB10(const Decimal& x, int k);
     Decimal Inc();
     Decimal Dec();
 
@@ -962,17 +1164,19 @@ public:
 };
 
 
-// NOTICE: This operator can convert SIGNED 64-bit integers to Decimal. This is required in
-// order to represent negative constants correctly. If you need to convert a literal >2^63
-// to a Decimal, use the string constructor instead.
-static inline Decimal operator"" _D(unsigned long long x)
-{
-    return Decimal(static_cast<long long>(x));
-}
-
-static inline Decimal operator"" _D(long double x)
+// NOTICE: Numeric literals are read from their source text, so integers of any size
+// (decimal, octal or hex, with or without ' separators) and floating literals convert
+// exactly, with no detour through a machine type. A leading minus is the unary operator
+// applied to the result.
+// Each literal is parsed once, on its first evaluation, into a function-local static:
+// the operator returns a const Decimal& to it, shared by every later evaluation. Copy
+// it to get a Decimal that can be modified.
+template <char... Cs>
+inline const Decimal& operator"" _D()
 {
-    return Decimal(x);
+    static const char literal[] = {Cs..., '\0'};
+    static const Decimal value = Decimal::FromLiteral(literal);
+    return value;
 }
 
 static inline Decimal operator"" _D(const char* x, size_t size)
@@ -981,6 +1185,112 @@ static inline Decimal operator"" _D(const char* x, size_t size)
     return Decimal(s);
 }
 
+/**
+ * Integer-only companion of Decimal.
+ *
+ * The value is kept in a Decimal with no decimals, so it shares the digit
+ * kernels, but none of the operations align scales, merge iterations or
+ * trim trailing zeros. Division truncates toward zero and the remainder
+ * takes the sign of the dividend, as with DivMod.
+ */
+class DecimalInt {
+    public:
+        DecimalInt() : DecimalInt(0LL) {}
+        DecimalInt(long long x);
+        // Throws unless x holds an integer. The rvalue form takes over the
+        // digits of x instead of copying them.
+        explicit DecimalInt(const Decimal& x);
+        explicit DecimalInt(Decimal&& x);
+
+        const Decimal& ToDecimal() const & { return v; }
+        Decimal ToDecimal() && { return std::move(v); }
+        std::string ToString() const { return v.ToString(); }
+
+        bool IsZero() const { return v.number.size() == 1 && v.number[0] == '0'; }
+        bool IsNegative() const { return v.sign == '-'; }
+        size_t Digits() const { return v.number.size(); }
+
+        // In-place kernels for operands below 10^18. MulAdd computes
+        // |*this| * m + a, DivSmall divides by d and returns the remainder
+        // of the magnitude.
+        DecimalInt& MulAdd(uint64_t m, uint64_t a);
+        uint64_t DivSmall(uint64_t d);
+
+        DecimalInt operator-() const;
+        friend DecimalInt operator+(const DecimalInt& left, const DecimalInt& right) { return Add(left, right); }
+        friend DecimalInt operator-(const DecimalInt& left, const DecimalInt& right) { return Add(left, -right); }
+        friend DecimalInt operator*(const DecimalInt& left, const DecimalInt& right) { return Mul(left, right); }
+        friend DecimalInt operator/(const DecimalInt& left, const DecimalInt& right) {
+            DecimalInt remainder;
+            return DivMod(left, right, remainder);
+        }
+        friend DecimalInt operator%(const DecimalInt& left, const DecimalInt& right) {
+            DecimalInt remainder;
+            DivMod(left, right, remainder);
+            return remainder;
+        }
+        static DecimalInt DivMod(const DecimalInt& left, const DecimalInt& right, DecimalInt& remainder);
+
+        DecimalInt& operator+=(const DecimalInt& right) { return *this = *this + right; }
+        DecimalInt& operator-=(const DecimalInt& right) { return *this = *this - right; }
+        DecimalInt& operator*=(const DecimalInt& right) { return *this = *this * right; }
+        DecimalInt& operator/=(const DecimalInt& right) { return *this = *this / right; }
+        DecimalInt& operator%=(const DecimalInt& right) { return *this = *this % right; }
+
+        // -1, 0 or 1 as left is lower, equal or greater than right.
+        static int Compare(const DecimalInt& left, const DecimalInt& right);
+        friend bool operator==(const DecimalInt& left, const DecimalInt& right) { return Compare(left, right) == 0; }
+        friend bool operator!=(const DecimalInt& left, const DecimalInt& right) { return Compare(left, right) != 0; }
+        friend bool operator<(const DecimalInt& left, const DecimalInt& right) { return Compare(left, right) < 0; }
+        friend bool operator<=(const DecimalInt& left, const DecimalInt& right) { return Compare(left, right) <= 0; }
+        friend bool operator>(const DecimalInt& left, const DecimalInt& right) { return Compare(left, right) > 0; }
+        friend bool operator>=(const DecimalInt& left, const DecimalInt& right) { return Compare(left, right) >= 0; }
+
+        friend std::ostream& operator<<(std::ostream& out, const DecimalInt& right) { return out << right.v; }
+
+    private:
+        Decimal v;
+
+        static DecimalInt Add(const DecimalInt& left, const DecimalInt& right);
+        static DecimalInt Mul(const DecimalInt& left, const DecimalInt& right);
+
+        // Drops leading zeros and gives zero a positive sign.
+        void Normalize();
+};
+
+/**
+ * Binary splitting for rational series of the form
+ *
+ * $S = \sum_{n=0}^{N-1}{a(n) \frac{p(0) \cdots p(n)}{q(0) \cdots q(n)}}$
+ *
+ * where p, q and a return small integers. Each half of [n1, n2) is reduced
+ * to three integers P, Q and T with S(n1, n2) = T / (q(0)...q(n1-1) * Q),
+ * and the halves are joined with a few multiplications. The digits grow
+ * evenly up the tree, so the products run in the fast kernels and the
+ * only division is the final T / Q.
+ */
+class DecimalSeries {
+    public:
+        typedef std::function<DecimalInt(unsigned long)> Term;
+
+        // P = p(n1)...p(n2-1), Q = q(n1)...q(n2-1), and T the sum of the
+        // terms over the same range scaled by Q.
+        struct Split {
+            DecimalInt P, Q, T;
+        };
+
+        DecimalSeries(Term p, Term q, Term a) : p(std::move(p)), q(std::move(q)), a(std::move(a)) {}
+
+        // Throws unless n1 < n2.
+        Split Evaluate(unsigned long n1, unsigned long n2) const;
+
+        // The first `terms` terms divided out to iterations.decimals places.
+        Decimal Sum(unsigned long terms, const DecimalIterations& iterations = DecimalIterations()) const;
+
+    private:
+        Term p, q, a;
+};
+
 class DecimalConstants {
 public:
     Decimal pE; // e
@@ -999,50 +1309,22 @@ public:
 
 private:
     DecimalIterations iterations;
-    void GenE();
 
-    void GenPi() {
-        pPi = 1_D/p_1Pi;
+    enum Constant {
+        C_E, C_PI, C_1PI, C_PI2, C_PI4, C_LN2, C_LN10, C_2PI,
+        C_2SQRTPI, C_LOG2E, C_LOG10E, C_SQRT2, C_1SQRT2, C_COUNT
     };
 
-    void Gen_1Pi();
-
-    void GenPi2() {
-        pPi2 = pPi/2_D;
-    }
-    void GenPi4() {
-        pPi4 = p_1Pi/4_D;
-    }
-    void GenLn2() {
-        pLn2 = xFD::Ln(2_D);
-    }
-    void GenLn10() {
-        pLn10 = xFD::Ln(10_D);
-    }
-
-    void Gen_2Pi() {
-        p_2Pi = p_1Pi * 2_D;
-    }
-
-    void Gen_2SqrtPi() {
-        p_2SqrtPi = 2_D / xFD::Sqrt(pPi);
-    }
-
-    void GenLog2E() {
-        pLog2E = xFD::Log(2_D, pE);
-    }
-    void GenLog10E() {
-        pLog10E = xFD::Log(10_D, pE);
-    }
-    void GenSqrt2() {
-        pSqrt2 = xFD::Sqrt(2_D);
-    }
-    void Gen_1Sqrt2() {
-        p_1Sqrt2 = 1_D/pSqrt2;
-    }
-
-    Decimal ImprovisedSqrt(const Decimal& x) const;
+    // Each constant is computed on its first use and kept for the life of
+    // the process, keyed by precision and shared by all threads. A request
+    // is served from any entry at least as precise, rounded down. Below
+    // DECIMAL_DIGITS_PLACES the digits come from the embedded tables, and
+    // past them from the store file when one is set.
+    static Decimal Get(Constant c, const DecimalIterations& iterations);
 
+    // c to at least work.decimals places, the last few of them guard digits.
+    static Decimal Raw(Constant c, const DecimalIterations& work);
+    static Decimal Compute(Constant c, const DecimalIterations& work);
 
 public:
 
@@ -1054,103 +1336,103 @@ public:
      * @param iterations        the number of iterations for calculation.
      *                          Higher iterations give more digits of precision.
      */
-    static Decimal E() {
-        DecimalConstants c;
-        return c.pE;
+    static Decimal E(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_E, iterations);
     }
 
 
     /**
-     * Calculates $\frac{1}{\pi}$ using an optimized Chudnovsky algorithm.
-     * See https://en.wikipedia.org/wiki/Chudnovsky_algorithm for details.
+     * Calculates $\pi$ using the Chudnovsky algorithm, summed by binary
+     * splitting. See https://en.wikipedia.org/wiki/Chudnovsky_algorithm
+     * for details.
      *
      * @param iterations        the number of iterations for calculation.
      *                          Higher iterations give more digits of precision.
      */
-    static Decimal Pi() {
-        DecimalConstants c;
-        return c.pPi;
+    static Decimal Pi(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_PI, iterations);
     }
 
     /**
-     * Calculates $\pi$.
+     * Calculates $\frac{1}{\pi}$ from the same series as Pi.
      *
      * @param iterations        the number of iterations for calculation.
      *                          Higher iterations give more digits of precision.
      *
      * @see _1Pi
      */
-    static Decimal _1Pi() {
-        DecimalConstants c;
-        return c.p_1Pi;
+    static Decimal _1Pi(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_1PI, iterations);
     }
 
-    static Decimal Pi2() {
-        DecimalConstants c;
-        return c.pPi2;
+    static Decimal Pi2(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_PI2, iterations);
     }
 
-    static Decimal Pi4() {
-        DecimalConstants c;
-        return c.pPi4;
+    static Decimal Pi4(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_PI4, iterations);
     }
 
-    static Decimal Ln2() {
-        DecimalConstants c;
-        return c.pLn2;
+    static Decimal Ln2(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_LN2, iterations);
     }
 
-    static Decimal Ln10() {
-        DecimalConstants c;
-        return c.pLn10;
+    static Decimal Ln10(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_LN10, iterations);
     }
 
-    static Decimal _2Pi() {
-        DecimalConstants c;
-        return c.p_2Pi;
+    static Decimal _2Pi(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_2PI, iterations);
     }
 
-    static Decimal _2SqrtPi() {
-        DecimalConstants c;
-        return c.p_2SqrtPi;
+    static Decimal _2SqrtPi(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_2SQRTPI, iterations);
     }
 
-    static Decimal Log2E() {
-        DecimalConstants c;
-        return c.pLog2E;
+    static Decimal Log2E(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_LOG2E, iterations);
     }
 
-    static Decimal Log10E() {
-        DecimalConstants c;
-        return c.pLog10E;
+    static Decimal Log10E(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_LOG10E, iterations);
     }
 
-    static Decimal Sqrt2() {
-        DecimalConstants c;
-        return c.pSqrt2;
+    static Decimal Sqrt2(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_SQRT2, iterations);
     }
 
-    static Decimal _1Sqrt2() {
-        DecimalConstants c;
-        return c.p_1Sqrt2;
+    static Decimal _1Sqrt2(const DecimalIterations& iterations = DecimalIterations()) {
+        return Get(C_1SQRT2, iterations);
     }
 
+    /**
+     * Keeps the constants computed past the embedded tables in the file at
+     * path, so that later processes map them instead of running the series
+     * again. Each constant is written back whenever a higher precision of it
+     * is computed. An empty path turns the store off, as it is by default.
+     * It needs mmap, and elsewhere does nothing.
+     */
+    static void SetStore(const std::string& path);
+
+    // Drops the constants computed so far in this process.
+    static void ClearCache();
+
     DecimalIterations Iterations() const { return iterations; }
     void SetIterations(const DecimalIterations& iterations) {
         this->iterations = iterations;
-        GenE();
-        GenPi();
-        Gen_1Pi();
-        GenPi2();
-        GenPi4();
-        GenLn2();
-        GenLn10();
-        Gen_2Pi();
-        Gen_2SqrtPi();
-        GenLog2E();
-        GenLog10E();
-        GenSqrt2();
-        Gen_1Sqrt2();
+        pE = E(iterations);
+        pPi = Pi(iterations);
+        p_1Pi = _1Pi(iterations);
+        pPi2 = Pi2(iterations);
+        pPi4 = Pi4(iterations);
+        pLn2 = Ln2(iterations);
+        pLn10 = Ln10(iterations);
+        p_2Pi = _2Pi(iterations);
+        p_2SqrtPi = _2SqrtPi(iterations);
+        pLog2E = Log2E(iterations);
+        pLog10E = Log10E(iterations);
+        pSqrt2 = Sqrt2(iterations);
+        p_1Sqrt2 = _1Sqrt2(iterations);
     }
 
     DecimalConstants(const DecimalIterations iterations = DecimalIterations()) {
@@ -1168,11 +1450,11 @@ class DecimalSequence {
     /**
      * Class for calculating the Bernoullis $B_n$ (This is *not* $B_2n$!)
      *
-     * This calculation utilizes the algorithm given in the research paper:
-     * Chowla and Hartung, An "exact" formula for the nth Bernoulli number,
-     * Acta Arithmetica 22 (1972) 113-115.
-     *
-     * Stirling approximations are not used because they aren't accurate enough.
+     * Even terms are computed exactly from the tangent numbers, with the
+     * integer recurrence given in the research paper:
+     * Brent and Zimmermann, Fast computation of Bernoulli, Tangent and
+     * Secant numbers, Springer Proceedings in Mathematics 50 (2013) 127-142.
+     * Only the final division rounds.
      *
      * @param n                 the sequence term of the desired Bernoulli number
      */
@@ -1193,4 +1475,30 @@ class SeqBernoulli: public DecimalSequence {
         }
 };
 
+/**
+ * Modular arithmetic context for a fixed modulus m > 0.
+ *
+ * Barrett's constant mu = floor(10^2k / m), where k is the number of digits
+ * of m, is computed once. Reducing a value below 10^2k then takes two
+ * truncated multiplications and at most a few subtractions instead of a
+ * long division. Larger values fall back to DivMod.
+ *
+ * All results are the least non-negative residue.
+ */
+class DecimalModulus {
+    public:
+        DecimalModulus(const Decimal& modulus);
+
+        const Decimal& Modulus() const { return m; }
+
+        Decimal Reduce(const Decimal& x) const;
+        Decimal MulMod(const Decimal& x, const Decimal& y) const;
+        Decimal AddMod(const Decimal& x, const Decimal& y) const;
+
+    private:
+        Decimal m;
+        Decimal mu;
+        size_t k;
+};
+
 #endif /* TYPES_DECIMAL_H */
@@ -8,11 +8,27 @@
 //XXX To get compiler constants
 
 #include "types/Decimal.h"
+#include "DecimalDigits.h"
+#ifdef HAVE_DECIMAL_TUNING
+#include "DecimalTuning.h"
+#endif
 #include <stdexcept>
 #include <limits.h>
 #include <float.h>
 #include <locale>
 #include <algorithm>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <mutex>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define DECIMAL_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 /**
  * Locale-independent version of std::to_string
@@ -26,145 +42,222 @@ std::string ToString(const T& t)
     return oss.str();
 }
 
+//Crossover defaults, overridden by the header that the tune tool writes
+#ifndef DECIMAL_KARATSUBA_DIGITS
+#define DECIMAL_KARATSUBA_DIGITS 64
+#endif
+
+#ifndef DECIMAL_NEWTON_DIV_DIGITS
+#define DECIMAL_NEWTON_DIV_DIGITS 128
+#endif
+
+#ifndef DECIMAL_HARDWARE_DECIMALS
+#define DECIMAL_HARDWARE_DECIMALS 15
+#endif
+
+#ifndef DECIMAL_DOUBLE_DOUBLE_DECIMALS
+#define DECIMAL_DOUBLE_DOUBLE_DECIMALS 30
+#endif
+
+#if defined(__GNUC__)
+#define DECIMAL_COLD __attribute__((cold, noinline))
+#else
+#define DECIMAL_COLD
+#endif
+
+//Sticky status flags of the calling thread, see Decimal::StatusFlag
+static thread_local unsigned status_flags = 0;
+
 //------------------------Private Methods--------------------------------
 
-Decimal Decimal::FromHex(const std::string& hex) {
-    Decimal a = 0_D, _16 = 16_D, boost = 1_D;
-    DecimalIterations its;
-    its.decimals = 0;
-    a.iterations = its;
-    a.sign = '+';
-    _16.iterations = its;
+DecimalTuning::DecimalTuning()
+{
+    karatsuba = DECIMAL_KARATSUBA_DIGITS;
+    newton_div = DECIMAL_NEWTON_DIV_DIGITS;
+    hardware = DECIMAL_HARDWARE_DECIMALS;
+    double_double = DECIMAL_DOUBLE_DOUBLE_DECIMALS;
+}
+
+DecimalTuning& Decimal::Tuning()
+{
+    static DecimalTuning tuning;
+    return tuning;
+}
+
+DECIMAL_COLD void Decimal::Signal(unsigned flags, bool toe, const char* msg)
+{
+    status_flags |= flags;
+    if (toe) {
+        throw DecimalIllegalOperation(msg);
+    }
+}
+
+unsigned Decimal::GetStatus()
+{
+    return status_flags;
+}
+
+bool Decimal::TestStatus(unsigned flags)
+{
+    return (status_flags & flags) != 0;
+}
 
-    Decimal _16boost = 1_D(its);
-    for (auto it = hex.rbegin(); it != hex.rend(); it++) {
-        if (*it == '-') {
-            a.sign = '-';
+void Decimal::ClearStatus(unsigned flags)
+{
+    status_flags &= ~flags;
+}
+
+Decimal Decimal::FromHex(const std::string& hex) {
+    DecimalInt a;
+    bool negative = false;
+    for (char c : hex) {
+        if (c == '-') {
+            negative = true;
             continue;
         }
-        else if (*it == '+') {
-            a.sign = '+'; // redundant
+        else if (c == '+') {
+            negative = false;
             continue;
         }
-        switch (*it) {
-            case '0':
-            break;
-            case '1':
-                a += 1_D(its) * _16boost;
-            break;
-            case '2':
-                a += 2_D(its) * _16boost;
-            break;
-            case '3':
-                a += 3_D(its) * _16boost;
-            break;
-            case '4':
-                a += 4_D(its) * _16boost;
-            break;
-            case '5':
-                a += 5_D(its) * _16boost;
-            break;
-            case '6':
-                a += 6_D(its) * _16boost;
-            break;
-            case '7':
-                a += 7_D(its) * _16boost;
-            break;
-            case '8':
-                a += 8_D(its) * _16boost;
-            break;
-            case '9':
-                a += 9_D(its) * _16boost;
-            break;
-            case 'a':
-            case 'A':
-                a += 10_D(its) * _16boost;
-            break;
-            case 'b':
-            case 'B':
-                a += 11_D(its) * _16boost;
-            break;
-            case 'c':
-            case 'C':
-                a += 12_D(its) * _16boost;
-            break;
-            case 'd':
-            case 'D':
-                a += 13_D(its) * _16boost;
-            break;
-            case 'e':
-            case 'E':
-                a += 14_D(its) * _16boost;
-            break;
-            case 'f':
-            case 'F':
-                a += 15_D(its) * _16boost;
-            break;
-            default:
-                throw DecimalIllegalOperation("Invalid hex character");
+        uint64_t v;
+        if (c >= '0' && c <= '9')
+            v = c - '0';
+        else if (c >= 'a' && c <= 'f')
+            v = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F')
+            v = c - 'A' + 10;
+        else
+            throw DecimalIllegalOperation("Invalid hex character");
+        a.MulAdd(16, v);
+    }
+    if (negative) {
+        a = -a;
+    }
+    Decimal res = std::move(a).ToDecimal();
+    res.iterations.decimals = 0;
+    return res;
+}
+
+Decimal Decimal::FromLiteral(const char* literal) {
+    std::string s;
+    for (const char* c = literal; *c; ++c) {
+        if (*c != '\'')
+            s += *c;
+    }
+
+    if (s.size() > 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+        Decimal res = FromHex(s.substr(2));
+        res.iterations = DecimalIterations();
+        return res;
+    }
+
+    size_t exp_pos = s.find_first_of("eE");
+    bool floating = exp_pos != std::string::npos || s.find('.') != std::string::npos;
+    if (!floating) {
+        if (s.size() > 1 && s[0] == '0') {
+            DecimalInt a;
+            for (size_t i = 1; i < s.size(); i++)
+                a.MulAdd(8, s[i] - '0');
+            return std::move(a).ToDecimal();
         }
-        _16boost *= _16;
+        return Decimal(s);
     }
-    return a;
+
+    // Mantissa digits with the point moved by the exponent.
+    std::string mantissa = s.substr(0, exp_pos), digits;
+    int exponent = (exp_pos == std::string::npos) ? 0 : std::stoi(s.substr(exp_pos + 1));
+    int places = 0;
+    size_t point = mantissa.find('.');
+    if (point != std::string::npos) {
+        places = static_cast<int>(mantissa.size() - point - 1);
+        mantissa.erase(point, 1);
+    }
+    digits = mantissa.empty() ? "0" : mantissa;
+    places -= exponent;
+    if (places < 0) {
+        digits.append(-places, '0');
+        places = 0;
+    }
+    if (places < 6) {
+        digits.append(6 - places, '0');
+        places = 6;
+    }
+    if (digits.size() <= static_cast<size_t>(places))
+        digits.insert(0, places - digits.size() + 1, '0');
+    digits.insert(digits.size() - places, ".");
+    return Decimal(digits);
+}
+
+bool Decimal::LeadApprox(double& mantissa, int& exponent) const noexcept
+{
+    if (type != NumType::_NORMAL)
+        return false;
+    int top = static_cast<int>(number.size()) - 1;
+    while (top >= 0 && number[top] == '0')
+        top--;
+    if (top < 0)
+        return false;
+
+    uint64_t lead = 0;
+    int k = top;
+    for (; k >= 0 && top - k < 17; k--)
+        lead = lead * 10 + CharToInt(number[k]);
+    mantissa = static_cast<double>(lead) / std::pow(10.0, top - k - 1);
+    if (sign == '-')
+        mantissa = -mantissa;
+    exponent = top - decimals;
+    return true;
+}
+
+Decimal Decimal::FromApprox(double v, int exponent, const DecimalIterations& its)
+{
+    Decimal tmp(its);
+    tmp.type = NumType::_NORMAL;
+    tmp.sign = (v < 0) ? '-' : '+';
+    v = std::fabs(v);
+    if (v == 0 || !std::isfinite(v)) {
+        tmp.number.push_back('0');
+        tmp.sign = '+';
+        return tmp;
+    }
+
+    int lead = static_cast<int>(std::floor(std::log10(v)));
+    unsigned long long digits = std::llround(v * std::pow(10.0, 16 - lead));
+    for (; digits > 0; digits /= 10)
+        tmp.number.push_back(IntToChar(digits % 10));
+    int shift = exponent + lead - 16;
+    if (shift >= 0) {
+        tmp.number.insert(tmp.number.begin(), shift, '0');
+    }
+    else {
+        tmp.decimals = -shift;
+        if (tmp.number.size() <= static_cast<size_t>(tmp.decimals))
+            tmp.number.insert(tmp.number.end(), tmp.decimals - tmp.number.size() + 1, '0');
+    }
+    tmp.TrailTrim();
+    return tmp;
 }
 
 //Comparator without sign, utilized by Comparators and Operations
-int Decimal::CompareNum(const Decimal& left, const Decimal& right)
+int Decimal::CompareNum(const Decimal& left, const Decimal& right) noexcept
 {
     if( (left.number.size() - left.decimals) > (right.number.size() - right.decimals) )
         return 1;
     else if( (left.number.size() - left.decimals) < (right.number.size() - right.decimals) )
         return 2;
 
-    if(left.decimals>right.decimals)
-    {
-        Decimal tmp;
-        tmp=right;
-        while (left.decimals>tmp.decimals)
-        {
-            tmp.decimals++;
-            tmp.number.push_front('0');
-        }
-
-        for (int i= left.number.size() - 1 ; i>=0; i--)
-        {
-            if(left.number[i]>tmp.number[i])
-                return 1;
-            else if(left.number[i]<tmp.number[i])
-                return 2;
-        }
-        return 0;
-    }
-    else if(left.decimals<right.decimals)
-    {
-        Decimal tmp;
-        tmp=left;
-        while (tmp.decimals<right.decimals)
-        {
-            tmp.decimals++;
-            tmp.number.push_front('0');
-        }
-
-        for (int i= tmp.number.size() - 1 ; i>=0; i--)
-        {
-            if(tmp.number[i]>right.number[i])
-                return 1;
-            else if(tmp.number[i]<right.number[i])
-                return 2;
-        }
-        return 0;
-    }
-    else
+    // The integer digits line up, so walk both from the top; the operand
+    // with fewer decimals reads zeros past its last digit.
+    int dec = std::max(left.decimals, right.decimals);
+    size_t loff = dec - left.decimals, roff = dec - right.decimals;
+    for (size_t i = left.number.size() + loff; i-- > 0; )
     {
-        for (int i = left.number.size() - 1 ; i>=0; i--)
-        {
-            if(left.number[i]>right.number[i])
-                return 1;
-            else if(left.number[i]<right.number[i])
-                return 2;
-        }
-        return 0;
+        char l = (i >= loff) ? left.number[i - loff] : '0';
+        char r = (i >= roff) ? right.number[i - roff] : '0';
+        if (l != r)
+            return (l > r) ? 1 : 2;
     }
+    return 0;
 };
 
 //Operations without sign and decimals, utilized by Operations
@@ -230,46 +323,485 @@ Decimal Decimal::Subtract(const Decimal& left, const Decimal& right)
     return tmp;
 };
 
+//Digit i of the aligned operands is number[i - offset], where the offset
+//is how many decimals the operand lacks. Opposite signs subtract with a
+//borrow; a borrow out of the top means right was the larger, and the
+//digits hold the ten's complement of the difference.
+Decimal Decimal::AddSigned(const Decimal& left, const Decimal& right, bool subtract)
+{
+    char rsign = subtract ? ((right.sign == '-') ? '+' : '-') : right.sign;
+    int dec = std::max(left.decimals, right.decimals);
+    size_t loff = dec - left.decimals, roff = dec - right.decimals;
+    size_t lend = left.number.size() + loff, rend = right.number.size() + roff;
+    size_t n = std::max(lend, rend);
+
+    std::deque<char> digits;
+    int carry = 0;
+    bool nonzero = false;
+    if (left.sign == rsign)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            int v = carry;
+            if (i >= loff && i < lend)
+                v += CharToInt(left.number[i - loff]);
+            if (i >= roff && i < rend)
+                v += CharToInt(right.number[i - roff]);
+            carry = v > 9;
+            digits.push_back(IntToChar(v - 10*carry));
+        }
+        if (carry)
+            digits.push_back('1');
+    }
+    else
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            int v = -carry;
+            if (i >= loff && i < lend)
+                v += CharToInt(left.number[i - loff]);
+            if (i >= roff && i < rend)
+                v -= CharToInt(right.number[i - roff]);
+            carry = v < 0;
+            v += 10*carry;
+            nonzero = nonzero || v != 0;
+            digits.push_back(IntToChar(v));
+        }
+        if (!nonzero)
+        {
+            // Exact zero, keeping the operands' iterations.
+            Decimal zero(left.iterations);
+            zero.iterations.decimals = (left.decimals < right.decimals) ? right.iterations.decimals : left.iterations.decimals;
+            zero.type = NumType::_NORMAL;
+            zero.sign = '+';
+            zero.number.push_back('0');
+            return zero;
+        }
+        if (carry)
+        {
+            size_t i = 0;
+            while (digits[i] == '0')
+                i++;
+            digits[i] = IntToChar(10 - CharToInt(digits[i]));
+            for (++i; i < n; ++i)
+                digits[i] = IntToChar(9 - CharToInt(digits[i]));
+        }
+    }
+
+    // Iterations as the kernel on the larger operand would give them, with
+    // the decimals of the longer scale.
+    bool right_wins = carry && left.sign != rsign;
+    Decimal tmp(right_wins ? right.iterations : left.iterations);
+    tmp.iterations.decimals = (left.decimals < right.decimals) ? right.iterations.decimals : left.iterations.decimals;
+    tmp.type = NumType::_NORMAL;
+    tmp.sign = right_wins ? rsign : left.sign;
+    tmp.decimals = dec;
+    tmp.number.swap(digits);
+    if (left.sign != rsign)
+        tmp.LeadTrim();
+    return tmp;
+}
 
 Decimal Decimal::Multiply(const Decimal& left, const Decimal& right)
 {
-    Decimal ris(left.iterations);
+    return MultiplyTrunc(left, right, 0);
+};
+
+//Short product: only the partial products that reach the digits from
+//position `cut` upwards are computed, and the result is the product
+//divided by 10^cut, low by at most one unit. A cut of 0 is exact.
+Decimal Decimal::MultiplyTrunc(const Decimal& left, const Decimal& right, int cut)
+{
     Decimal tmp(left.iterations);
     tmp.type = Decimal::NumType::_NORMAL;
-    ris.number.push_back('0');
-    int carry=0;
+    size_t la = left.number.size(), lb = right.number.size();
+    if (cut < 0)
+        cut = 0;
+    if (la == 0 || lb == 0 || static_cast<size_t>(cut) >= la + lb)
+    {
+        tmp.number.push_back('0');
+        return tmp;
+    }
+
+    // Past the crossover the full Karatsuba product is cheaper than even
+    // the short schoolbook one, and dropping its low digits is exact.
+    if (std::min(la, lb) >= static_cast<size_t>(Tuning().karatsuba))
+    {
+        tmp = MultiplyKaratsuba(left, right);
+        tmp.number.erase(tmp.number.begin(), tmp.number.begin() + cut);
+        return tmp;
+    }
+
+    // Every dropped column holds at most 81 * min(la, lb), so this many
+    // guard columns keep the carry into `cut` off by less than one.
+    int guard = 2;
+    for (size_t m = std::min(la, lb); m > 0; m /= 10)
+        guard++;
+    size_t lo = (cut > guard) ? cut - guard : 0;
+
+    std::vector<int> a(la), b(lb);
+    for (size_t i = 0; i < la; ++i)
+        a[i] = CharToInt(left.number[i]);
+    for (size_t j = 0; j < lb; ++j)
+        b[j] = CharToInt(right.number[j]);
 
-    for (size_t i=0; i<right.number.size(); ++i)
+    std::vector<uint64_t> acc(la + lb - lo, 0);
+    for (size_t i = 0; i < la; ++i)
     {
-        for (size_t k=0; k<i ; ++k)
+        if (a[i] == 0)
+            continue;
+        size_t j = (lo > i) ? lo - i : 0;
+        for (; j < lb; ++j)
+            acc[i + j - lo] += a[i] * b[j];
+    }
+
+    uint64_t carry = 0;
+    for (size_t k = 0; k < acc.size(); ++k)
+    {
+        uint64_t aus = acc[k] + carry;
+        carry = aus / 10;
+        if (k + lo >= static_cast<size_t>(cut))
+            tmp.number.push_back(IntToChar(aus % 10));
+    }
+    while (carry != 0)
+    {
+        tmp.number.push_back(IntToChar(carry % 10));
+        carry /= 10;
+    }
+
+    return tmp;
+};
+
+//Square without sign and decimals: every cross product is computed once
+//and counted twice.
+Decimal Decimal::Square(const Decimal& x)
+{
+    Decimal tmp(x.iterations);
+    tmp.type = Decimal::NumType::_NORMAL;
+    size_t l = x.number.size();
+    if (l == 0)
+    {
+        tmp.number.push_back('0');
+        return tmp;
+    }
+
+    if (l >= static_cast<size_t>(Tuning().karatsuba))
+        return MultiplyKaratsuba(x, x);
+
+    std::vector<int> a(l);
+    for (size_t i = 0; i < l; ++i)
+        a[i] = CharToInt(x.number[i]);
+
+    std::vector<uint64_t> acc(2 * l, 0);
+    for (size_t i = 0; i < l; ++i)
+    {
+        if (a[i] == 0)
+            continue;
+        acc[2 * i] += a[i] * a[i];
+        int twice = 2 * a[i];
+        for (size_t j = i + 1; j < l; ++j)
+            acc[i + j] += twice * a[j];
+    }
+
+    uint64_t carry = 0;
+    for (size_t k = 0; k < acc.size(); ++k)
+    {
+        uint64_t aus = acc[k] + carry;
+        carry = aus / 10;
+        tmp.number.push_back(IntToChar(aus % 10));
+    }
+
+    return tmp;
+};
+
+//Karatsuba on two digit polynomials of n coefficients each, adding the
+//2n product coefficients into `out`. Carries are left to the caller, so
+//the middle product is formed by plain subtraction.
+static void KaratsubaPoly(const int64_t* a, const int64_t* b, size_t n, int64_t* out, size_t base)
+{
+    if (n < base)
+    {
+        for (size_t i = 0; i < n; ++i)
         {
-            tmp.number.push_front('0');
+            if (a[i] == 0)
+                continue;
+            for (size_t j = 0; j < n; ++j)
+                out[i + j] += a[i] * b[j];
         }
+        return;
+    }
+
+    // (a1 X + a0)(b1 X + b0) with X = 10^h, the high halves take the odd digit.
+    size_t h = n / 2, m = n - h;
+    std::vector<int64_t> sa(m), sb(m), z0(2 * h, 0), z1(2 * m, 0), z2(2 * m, 0);
+    for (size_t i = 0; i < m; ++i)
+    {
+        sa[i] = a[h + i] + ((i < h) ? a[i] : 0);
+        sb[i] = b[h + i] + ((i < h) ? b[i] : 0);
+    }
+    KaratsubaPoly(a, b, h, z0.data(), base);
+    KaratsubaPoly(a + h, b + h, m, z2.data(), base);
+    KaratsubaPoly(sa.data(), sb.data(), m, z1.data(), base);
+
+    for (size_t k = 0; k < 2 * h; ++k)
+    {
+        out[k] += z0[k];
+        out[h + k] -= z0[k];
+    }
+    for (size_t k = 0; k < 2 * m; ++k)
+    {
+        out[2 * h + k] += z2[k];
+        out[h + k] += z1[k] - z2[k];
+    }
+}
+
+//Karatsuba product without sign and decimals. The longer operand is cut
+//into blocks as long as the shorter one, so that lopsided products don't
+//pay for padding.
+Decimal Decimal::MultiplyKaratsuba(const Decimal& left, const Decimal& right)
+{
+    Decimal tmp(left.iterations);
+    tmp.type = Decimal::NumType::_NORMAL;
+    const Decimal& lg = (left.number.size() >= right.number.size()) ? left : right;
+    const Decimal& sm = (&lg == &left) ? right : left;
+    size_t L = lg.number.size(), m = sm.number.size();
+    size_t base = std::max(Tuning().karatsuba, 2);
+
+    std::vector<int64_t> b(m), blk(m), prod(2 * m), acc(L + 2 * m, 0);
+    for (size_t j = 0; j < m; ++j)
+        b[j] = CharToInt(sm.number[j]);
+
+    for (size_t off = 0; off < L; off += m)
+    {
+        for (size_t i = 0; i < m; ++i)
+            blk[i] = (off + i < L) ? CharToInt(lg.number[off + i]) : 0;
+        std::fill(prod.begin(), prod.end(), 0);
+        KaratsubaPoly(blk.data(), b.data(), m, prod.data(), base);
+        for (size_t k = 0; k < 2 * m; ++k)
+            acc[off + k] += prod[k];
+    }
+
+    int64_t carry = 0;
+    for (size_t k = 0; k < L + m; ++k)
+    {
+        int64_t aus = acc[k] + carry;
+        carry = aus / 10;
+        tmp.number.push_back(IntToChar(aus % 10));
+    }
+
+    return tmp;
+};
+
+//Below this the base case of RecipNum would divide through Newton again.
+static const int NEWTON_DIV_MIN = 32;
+
+//Long division without sign and decimals, utilized by DivMod and Divide
+void Decimal::DivModNum(const Decimal& left, const Decimal& right, Decimal& quotient, Decimal& remainder)
+{
+    size_t ln = left.number.size(), rn = right.number.size() - right.decimals;
+    size_t threshold = static_cast<size_t>(std::max(Tuning().newton_div, NEWTON_DIV_MIN));
+    if (rn >= threshold && ln >= rn + threshold)
+    {
+        DivModNewton(left, right, quotient, remainder);
+        return;
+    }
+
+    Decimal Q(left.iterations), R(left.iterations);
+    Q.type = Decimal::NumType::_NORMAL;
+    R.type = Decimal::NumType::_NORMAL;
+    Q.sign = '+';
+    R.sign = '+';
+
+    // Multiples 0..9 of the divisor, so each quotient digit costs a
+    // binary search and at most one subtraction.
+    Decimal multiples[10];
+    multiples[0] = Decimal(left.iterations);
+    multiples[0].type = Decimal::NumType::_NORMAL;
+    multiples[0].number.push_back('0');
+    multiples[1] = right;
+    multiples[1].decimals = 0;
+    multiples[1].LeadTrim();
+    for (int k = 2; k < 10; k++)
+        multiples[k] = Sum(multiples[k-1], multiples[1]);
+
+    for (auto it = left.number.rbegin(); it != left.number.rend(); ++it)
+    {
+        R.number.push_front(*it);
+        R.LeadTrim();
 
-        for (size_t j=0; j<left.number.size() ; ++j)
+        int lo = 0, hi = 9;
+        while (lo < hi)
         {
-            int aus= CharToInt(right.number[i]) * CharToInt(left.number[j]) + carry;
-            carry=0;
-            if(aus>9)
-            {
-                while(aus>9)
-                {
-                    carry++;
-                    aus-=10;
-                }
-            }
-            tmp.number.push_back(IntToChar(aus));
+            int mid = (lo + hi + 1) / 2;
+            if (CompareNum(R, multiples[mid]) == 2)
+                hi = mid - 1;
+            else
+                lo = mid;
+        }
+        if (lo > 0)
+        {
+            R = Subtract(R, multiples[lo]);
+            R.LeadTrim();
         }
+        Q.number.push_front(IntToChar(lo));
+    }
 
-        if(carry!=0)
-            tmp.number.push_back(IntToChar(carry));
-        carry=0;
+    if (Q.number.empty())
+        Q.number.push_back('0');
+    if (R.number.empty())
+        R.number.push_back('0');
+    Q.LeadTrim();
+
+    quotient = Q;
+    remainder = R;
+};
+
+//Newton reciprocal without sign and decimals: about p+1 digits of
+//10^(digits(d)+p) / d, off by a few units. Only the top p+2 digits of
+//the divisor matter, and each step doubles the digits of the one below.
+Decimal Decimal::RecipNum(const Decimal& d, int p)
+{
+    size_t t = std::min(d.number.size(), static_cast<size_t>(p) + 2);
+    Decimal top = d;
+    top.number.erase(top.number.begin(), top.number.end() - t);
+
+    Decimal scale(d.iterations);
+    scale.type = NumType::_NORMAL;
+    scale.number.assign(t + p, '0');
+    scale.number.push_back('1');
+
+    Decimal X, r;
+    if (p + 1 < std::max(Tuning().newton_div, NEWTON_DIV_MIN))
+    {
+        DivModNum(scale, top, X, r);
+        return X;
+    }
+
+    // X = X0 + X0 (10^(t+p) - top X0) / 10^(t+p)
+    int h = p / 2 + 1;
+    X = RecipNum(top, h);
+    X.number.insert(X.number.begin(), p - h, '0');
+    Decimal P = Multiply(top, X);
+    P.LeadTrim();
+    bool over = CompareNum(P, scale) == 1;
+    Decimal E = over ? Subtract(P, scale) : Subtract(scale, P);
+    E.LeadTrim();
+    Decimal corr = Multiply(X, E);
+    if (corr.number.size() > t + p)
+        corr.number.erase(corr.number.begin(), corr.number.begin() + t + p);
+    else
+        corr.number.assign(1, '0');
+    X = over ? Subtract(X, corr) : Sum(X, corr);
+    X.LeadTrim();
+    return X;
+};
+
+//Integer division through RecipNum, the estimate is then corrected by
+//at most a few multiples of the divisor.
+void Decimal::DivModNewton(const Decimal& left, const Decimal& right, Decimal& quotient, Decimal& remainder)
+{
+    Decimal N = left, D = right;
+    N.decimals = 0;
+    D.decimals = 0;
+    N.LeadTrim();
+    D.LeadTrim();
+    size_t n = N.number.size(), d = D.number.size();
+
+    Decimal one(left.iterations);
+    one.type = NumType::_NORMAL;
+    one.number.push_back('1');
+
+    // Q = N X / 10^(n+2) with X ~ 10^(n+2) / D
+    int p = static_cast<int>(n - d) + 2;
+    Decimal Q = Multiply(N, RecipNum(D, p));
+    if (Q.number.size() > n + 2)
+        Q.number.erase(Q.number.begin(), Q.number.begin() + n + 2);
+    else
+        Q.number.assign(1, '0');
+    Q.LeadTrim();
+
+    Decimal P = Multiply(Q, D);
+    P.LeadTrim();
+    while (CompareNum(P, N) == 1)
+    {
+        Q = Subtract(Q, one);
+        Q.LeadTrim();
+        P = Subtract(P, D);
+        P.LeadTrim();
+    }
+    Decimal R = Subtract(N, P);
+    R.LeadTrim();
+    while (CompareNum(R, D) != 2)
+    {
+        Q = Sum(Q, one);
+        R = Subtract(R, D);
+        R.LeadTrim();
+    }
+
+    Q.sign = '+';
+    R.sign = '+';
+    quotient = Q;
+    remainder = R;
+};
+
+//Integer square root without sign and decimals, utilized by Sqrt, RSqrt and ISqrt
+Decimal Decimal::ISqrtNum(const Decimal& x, Decimal& remainder)
+{
+    Decimal n = x;
+    n.sign = '+';
+    n.decimals = 0;
+    n.LeadTrim();
 
-        ris= Sum(ris,tmp);
-        tmp.number.clear();
+    if (n.number.size() <= 18)
+    {
+        unsigned long long v = 0, s;
+        for (auto it = n.number.rbegin(); it != n.number.rend(); ++it)
+            v = v*10 + CharToInt(*it);
+        s = static_cast<unsigned long long>(std::sqrt(static_cast<long double>(v)));
+        while (s*s > v)
+            s--;
+        while ((s+1)*(s+1) <= v)
+            s++;
+        Decimal root(x.iterations), rem(x.iterations);
+        root = s;
+        rem = v - s*s;
+        root.iterations = x.iterations;
+        rem.iterations = x.iterations;
+        remainder = rem;
+        return root;
+    }
+
+    // Precision doubling: the root of the top half of the digits
+    // gives the top half of the root, and an overestimate built from
+    // it converges in one or two Newton steps at full size.
+    size_t h = n.number.size() / 4;
+    Decimal top = n, r, q;
+    top.number.erase(top.number.begin(), top.number.begin() + 2*h);
+    Decimal s = ISqrtNum(top, r);
+
+    Decimal one(x.iterations), two(x.iterations);
+    one = 1;
+    two = 2;
+    Decimal root = Sum(s, one);
+    root.number.insert(root.number.begin(), h, '0');
+    root.LeadTrim();
+    while (true)
+    {
+        DivModNum(n, root, q, r);
+        Decimal next;
+        DivModNum(Sum(root, q), two, next, r);
+        if (CompareNum(next, root) != 2)
+            break;
+        root = next;
     }
 
-    return ris;
+    remainder = Subtract(n, Multiply(root, root));
+    remainder.LeadTrim();
+    remainder.sign = '+';
+    remainder.type = NumType::_NORMAL;
+    root.sign = '+';
+    root.type = NumType::_NORMAL;
+    return root;
 };
 
 //------------------------Public Methods--------------------------------
@@ -362,49 +894,49 @@ Decimal& Decimal::operator=(unsigned char Num)
 
 Decimal& Decimal::operator=(short Num)
 {
-    *this = ::ToString(Num);
+    *this = FromInteger(Magnitude(Num), Num < 0);
     return *this;
 };
 
 Decimal& Decimal::operator=(unsigned short Num)
 {
-    *this = ::ToString(Num);
+    *this = FromInteger(Num, false);
     return *this;
 };
 
 Decimal& Decimal::operator=(int Num)
 {
-    *this = ::ToString(Num);
+    *this = FromInteger(Magnitude(Num), Num < 0);
     return *this;
 };
 
 Decimal& Decimal::operator=(unsigned int Num)
 {
-    *this = ::ToString(Num);
+    *this = FromInteger(Num, false);
     return *this;
 };
 
 Decimal& Decimal::operator=(long Num)
 {
-    *this = ::ToString(Num);
+    *this = FromInteger(Magnitude(Num), Num < 0);
     return *this;
 };
 
 Decimal& Decimal::operator=(unsigned long Num)
 {
-    *this = ::ToString(Num);
+    *this = FromInteger(Num, false);
     return *this;
 };
 
 Decimal& Decimal::operator=(long long Num)
 {
-    *this = ::ToString(Num);
+    *this = FromInteger(Magnitude(Num), Num < 0);
     return *this;
 };
 
 Decimal& Decimal::operator=(unsigned long long Num)
 {
-    *this = ::ToString(Num);
+    *this = FromInteger(Num, false);
     return *this;
 };
 
@@ -426,265 +958,228 @@ Decimal& Decimal::operator=(long double Num)
     return *this;
 };
 
-//Operations
-Decimal operator+ ( const Decimal& left_, const Decimal& right_ )
+#ifdef __SIZEOF_INT128__
+//Native tier: the digits are read into an unsigned __int128 scaled to a
+//common number of decimals, so an operation costs a few instructions
+//instead of passes over the deques. Anything that may overflow goes back
+//to the digit kernels.
+static const size_t INT128_DIGITS = 38;
+static const uint64_t POW10_19 = 10000000000000000000ULL;
+
+static size_t Int128Digits(unsigned __int128 v)
 {
-    Decimal tmp(left_.iterations);
-    tmp.type = Decimal::NumType::_NORMAL;
-    tmp.iterations.throw_on_error = left_.iterations.TOE() || right_.iterations.TOE();
+    size_t n = 0;
+    while (v != 0) {
+        v /= 10;
+        n++;
+    }
+    return n;
+}
 
-    Decimal left,right;
-    left=left_;
-    right=right_;
+bool Decimal::ToInt128(const Decimal& x, int decimals, unsigned __int128& magnitude) noexcept
+{
+    if (x.type != NumType::_NORMAL || decimals < x.decimals ||
+            x.number.size() + (decimals - x.decimals) > INT128_DIGITS)
+        return false;
+    unsigned __int128 v = 0;
+    for (size_t i = x.number.size(); i-- > 0; )
+        v = v * 10 + CharToInt(x.number[i]);
+    for (int k = x.decimals; k < decimals; k++)
+        v *= 10;
+    magnitude = v;
+    return true;
+}
 
-    if (left.IsNaN() || right.IsNaN()) {
-        if (left.iterations.TOE() || right.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
-        tmp.SpecialClear();
-        tmp.type = Decimal::NumType::_NAN;
-        return tmp;
-    }
-    else if (left.IsInf() || right.IsInf()) {
-        if (left.sign != right.sign) {
-            if (left.iterations.TOE() || right.iterations.TOE()) {
-                throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-            }
-            tmp.SpecialClear();
-            tmp.type = Decimal::NumType::_NAN;
-            return tmp;
-        }
-        return left; // Or equivalently, right
-    }
+Decimal Decimal::FromInt128(unsigned __int128 magnitude, char sign, int decimals, const DecimalIterations& its)
+{
+    Decimal tmp(its);
+    tmp.type = NumType::_NORMAL;
+    tmp.sign = sign;
+    tmp.decimals = decimals;
+    // Peel 19 digits at a time so that the inner loop is 64-bit.
+    do {
+        uint64_t chunk = static_cast<uint64_t>(magnitude % POW10_19);
+        magnitude /= POW10_19;
+        for (int k = 0; k < 19 && (chunk != 0 || magnitude != 0); k++) {
+            tmp.number.push_back(IntToChar(chunk % 10));
+            chunk /= 10;
+        }
+    } while (magnitude != 0);
+    if (tmp.number.empty())
+        tmp.number.push_back('0');
+    if (tmp.number.size() < static_cast<size_t>(decimals) + 1)
+        tmp.number.insert(tmp.number.end(), decimals + 1 - tmp.number.size(), '0');
+    return tmp;
+}
 
-    if(left.decimals>right.decimals) {
-        while(left.decimals>right.decimals)
-        {
-            right.decimals++;
-            right.number.push_front('0');
-        }
-        right.iterations.decimals = left.iterations.decimals;
+bool Decimal::AddInt128(const Decimal& left, const Decimal& right, bool subtract, Decimal& result)
+{
+    int dec = std::max(left.decimals, right.decimals);
+    unsigned __int128 a, b;
+    if (!ToInt128(left, dec, a) || !ToInt128(right, dec, b))
+        return false;
+
+    // Both magnitudes are below 10^38, so neither the sum nor the
+    // difference can wrap.
+    bool opposite = subtract ? (left.sign == right.sign) : (left.sign != right.sign);
+
+    // Mirror the digit path: the iterations follow the operand the kernel
+    // was called with, and the decimals those of the longer scale.
+    bool right_wins = opposite && b > a;
+    DecimalIterations its = right_wins ? right.iterations : left.iterations;
+    its.decimals = (left.decimals < right.decimals) ? right.iterations.decimals : left.iterations.decimals;
+    if (opposite && a == b) {
+        // Exact zero, keeping the operands' iterations.
+        result = FromInt128(0, '+', 0, its);
+        return true;
     }
-    else if    (left.decimals<right.decimals) {
-        while(left.decimals<right.decimals)
-        {
-            left.decimals++;
-            left.number.push_front('0');
-        }
-        left.iterations.decimals = right.iterations.decimals;
+
+    char sign;
+    if (!opposite)
+        sign = left.sign;
+    else if (right_wins)
+        sign = subtract ? ((right.sign == '+') ? '-' : '+') : right.sign;
+    else
+        sign = left.sign;
+    result = FromInt128(opposite ? (right_wins ? b - a : a - b) : a + b, sign, dec, its);
+    return true;
+}
+
+bool Decimal::MulInt128(const Decimal& left, const Decimal& right, Decimal& result)
+{
+    unsigned __int128 a, b, p;
+    if (!ToInt128(left, left.decimals, a) || !ToInt128(right, right.decimals, b) ||
+            __builtin_mul_overflow(a, b, &p))
+        return false;
+
+    DecimalIterations its = left.iterations;
+    its.decimals = std::max(left.iterations.decimals, right.iterations.decimals);
+    result = FromInt128(p, (left.sign == right.sign) ? '+' : '-', left.decimals + right.decimals, its);
+    result.TrailTrim();
+    return true;
+}
+
+bool Decimal::DivInt128(const Decimal& left, const Decimal& right, Decimal& result)
+{
+    unsigned __int128 a, b;
+    if (!ToInt128(left, left.decimals, a) || !ToInt128(right, right.decimals, b) || b == 0)
+        return false;
+
+    // left/right = a/b * 10^(db-da), wanted with p decimals.
+    int p = right.iterations.decimals;
+    int shift = right.decimals - left.decimals + p;
+    if (shift < 0) {
+        for (int k = shift; k < 0; k++)
+            if (__builtin_mul_overflow(b, 10, &b))
+                return false;
+        shift = 0;
+    }
+    size_t bdigits = Int128Digits(b);
+    if (bdigits >= INT128_DIGITS)
+        return false;
+
+    unsigned __int128 q = a / b, r = a % b;
+    std::string frac;
+    // Long division of the remainder, several digits per native division.
+    size_t step = std::min<size_t>(19, INT128_DIGITS - bdigits);
+    for (int left_digits = shift; left_digits > 0; ) {
+        int k = std::min<int>(step, left_digits);
+        unsigned __int128 scale = 1;
+        for (int i = 0; i < k; i++)
+            scale *= 10;
+        r *= scale;
+        uint64_t chunk = static_cast<uint64_t>(r / b);
+        r %= b;
+        std::string digits(k, '0');
+        for (int i = k - 1; i >= 0; i--) {
+            digits[i] = IntToChar(chunk % 10);
+            chunk /= 10;
+        }
+        frac += digits;
+        left_digits -= k;
+    }
+
+    DecimalIterations its = left.iterations;
+    its.decimals = std::max(left.iterations.decimals, right.iterations.decimals);
+    Decimal tmp = FromInt128(q, (left.sign == right.sign) ? '+' : '-', 0, its);
+    tmp.number.insert(tmp.number.begin(), frac.rbegin(), frac.rend());
+    tmp.decimals = p;
+    if (tmp.number.size() < static_cast<size_t>(p) + 1)
+        tmp.number.insert(tmp.number.end(), p + 1 - tmp.number.size(), '0');
+    if (r != 0)
+        status_flags |= STATUS_INEXACT;
+    if (!right.iterations.trunc_not_round && 2 * r >= b) {
+        size_t i = 0;
+        for (; i < tmp.number.size() && tmp.number[i] == '9'; i++)
+            tmp.number[i] = '0';
+        if (i == tmp.number.size())
+            tmp.number.push_back('1');
+        else
+            ++tmp.number[i];
     }
-        
+    tmp.LeadTrim();
+    tmp.TrailTrim();
+    result = tmp;
+    return true;
+}
+#endif
 
-    if( (left.sign=='+')&& (right.sign=='-'))
+//Operations
+Decimal operator+ ( const Decimal& left, const Decimal& right )
+{
+#ifdef __SIZEOF_INT128__
     {
-        int check= Decimal::CompareNum(left,right);
-        if(check==0)
-        {
-            tmp = 0;
-            return tmp;
-        }
-        if(check==1)
-        {
-            tmp=Decimal::Subtract(left,right);
-            tmp.sign='+';
-            tmp.decimals=left.decimals;
-            tmp.iterations.decimals=left.iterations.decimals;
-            tmp.LeadTrim();
-            return tmp;
-        }
-        if(check==2)
-        {
-            tmp=Decimal::Subtract(right,left);
-            tmp.sign='-';
-            tmp.decimals=left.decimals;
-            tmp.iterations.decimals=left.iterations.decimals;
-            tmp.LeadTrim();
-            return tmp;
-        }
+        Decimal fast;
+        if (Decimal::AddInt128(left, right, false, fast))
+            return fast;
     }
-    if( (left.sign=='-')&& (right.sign=='+'))
-    {
-        int check= Decimal::CompareNum(left,right);
-        if(check==0)
-        {
-            tmp = 0;
-            return tmp;
-        }
-        if(check==1)
-        {
-            tmp=Decimal::Subtract(left,right);
-            tmp.sign='-';
-            tmp.decimals=left.decimals;
-            tmp.iterations.decimals=left.iterations.decimals;
-            tmp.LeadTrim();
-            return tmp;
-        }
-        if(check==2)
-        {
-            tmp=Decimal::Subtract(right,left);
-            tmp.sign='+';
-            tmp.decimals=left.decimals;
-            tmp.iterations.decimals=left.iterations.decimals;
-            tmp.LeadTrim();
-            return tmp;
+#endif
+    if (left.IsNaN() || right.IsNaN()) {
+        Decimal::Signal(Decimal::STATUS_INVALID, left.iterations.TOE() || right.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return Decimal::NaN();
+    }
+    else if (left.IsInf() || right.IsInf()) {
+        if (left.sign != right.sign) {
+            Decimal::Signal(Decimal::STATUS_INVALID, left.iterations.TOE() || right.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+            return Decimal::NaN();
         }
+        return left; // Or equivalently, right
     }
 
-    if( (left.sign=='+')&& (right.sign=='+'))
-    {
-        tmp=Decimal::Sum(left,right);
-        tmp.sign='+';
-        tmp.decimals=left.decimals;
-        tmp.iterations.decimals=left.iterations.decimals;
-        return tmp;
-    }
-    if( (left.sign=='-')&& (right.sign=='-'))
-    {
-        tmp=Decimal::Sum(left,right);
-        tmp.sign='-';
-        tmp.decimals=left.decimals;
-        tmp.iterations.decimals=left.iterations.decimals;
-        return tmp;
-    }
-    // Should not get here
-    throw DecimalIllegalOperation("Decimal assertion failure");
+    return Decimal::AddSigned(left, right, false);
 };
 
-Decimal operator- ( const Decimal& left_, const Decimal& right_ )
+Decimal operator- ( const Decimal& left, const Decimal& right )
 {
-    Decimal tmp(left_.iterations);
-    tmp.type = Decimal::NumType::_NORMAL;
-    tmp.iterations.throw_on_error = left_.iterations.TOE() || right_.iterations.TOE();
-
-    Decimal left,right;
-    left=left_;
-    right=right_;
-
+#ifdef __SIZEOF_INT128__
+    {
+        Decimal fast;
+        if (Decimal::AddInt128(left, right, true, fast))
+            return fast;
+    }
+#endif
     if (left.IsNaN() || right.IsNaN()) {
-        if (left.iterations.TOE() || right.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
-        tmp.SpecialClear();
-        tmp.type = Decimal::NumType::_NAN;
-        return tmp;
+        Decimal::Signal(Decimal::STATUS_INVALID, left.iterations.TOE() || right.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return Decimal::NaN();
     }
     else if (left.IsInf() && right.IsInf()) {
         if (left.sign == right.sign) {
-            if (left.iterations.TOE() || right.iterations.TOE()) {
-                throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-            }
-            tmp.SpecialClear();
-            tmp.type = Decimal::NumType::_NAN;
-            return tmp;
+            Decimal::Signal(Decimal::STATUS_INVALID, left.iterations.TOE() || right.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+            return Decimal::NaN();
         }
     }
 
     if (left.IsInf()) {
-        if (left.iterations.TOE() || right.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Decimal::Signal(0, left.iterations.TOE() || right.iterations.TOE(), "IEE754 special number arithmetic is disabled");
         return left;
     }
     else if (right.IsInf()) {
-        if (left.iterations.TOE() || right.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Decimal::Signal(0, left.iterations.TOE() || right.iterations.TOE(), "IEE754 special number arithmetic is disabled");
         // Invert the sign
         return -right;
     }
 
-
-    if(left.decimals>right.decimals) {
-        while(left.decimals>right.decimals)
-        {
-            right.decimals++;
-            right.number.push_front('0');
-        }
-        right.iterations.decimals = left.iterations.decimals;
-    }
-    else if (left.decimals<right.decimals) {
-        while(left.decimals<right.decimals)
-        {
-            left.decimals++;
-            left.number.push_front('0');
-        }
-        left.iterations.decimals = right.iterations.decimals;
-    }
-
-    if( (left.sign=='+')&& (right.sign=='-'))
-    {
-        tmp=Decimal::Sum(left,right);
-        tmp.sign='+';
-        tmp.decimals=left.decimals;
-        tmp.iterations.decimals=left.iterations.decimals;
-        return tmp;
-    }
-    if( (left.sign=='-')&& (right.sign=='+'))
-    {
-        tmp=Decimal::Sum(left,right);
-        tmp.sign='-';
-        tmp.decimals=left.decimals;
-        tmp.iterations.decimals=left.iterations.decimals;
-        return tmp;
-    }
-
-    if( (left.sign=='+')&& (right.sign=='+'))
-    {
-        int check= Decimal::CompareNum(left,right);
-        if(check==0)
-        {
-            tmp=0;
-            return tmp;
-        }
-        if(check==1)
-        {
-            tmp=Decimal::Subtract(left,right);
-            tmp.sign='+';
-            tmp.decimals=left.decimals;
-            tmp.iterations.decimals=left.iterations.decimals;
-            tmp.LeadTrim();
-            return tmp;
-        }
-        if(check==2)
-        {
-            tmp=Decimal::Subtract(right,left);
-            tmp.sign='-';
-            tmp.decimals=left.decimals;
-            tmp.iterations.decimals=left.iterations.decimals;
-            tmp.LeadTrim();
-            return tmp;
-        }
-    }
-
-    if( (left.sign=='-')&& (right.sign=='-'))
-    {
-        int check= Decimal::CompareNum(left,right);
-        if(check==0)
-        {
-            tmp = 0;
-            return tmp;
-        }
-        if(check==1)
-        {
-            tmp=Decimal::Subtract(left,right);
-            tmp.sign='-';
-            tmp.decimals=left.decimals;
-            tmp.iterations.decimals=left.iterations.decimals;
-            tmp.LeadTrim();
-            return tmp;
-        }
-        if(check==2)
-        {
-            tmp=Decimal::Subtract(right,left);
-            tmp.sign='+';
-            tmp.decimals=left.decimals;
-            tmp.iterations.decimals=left.iterations.decimals;
-            tmp.LeadTrim();
-            return tmp;
-        }
-    }
-    // Should not get here
-    throw DecimalIllegalOperation("Decimal assertion failure");
+    return Decimal::AddSigned(left, right, true);
 };
 
 Decimal operator*(const Decimal& left, const Decimal& right)
@@ -694,17 +1189,13 @@ Decimal operator*(const Decimal& left, const Decimal& right)
     tmp.iterations.throw_on_error = left.iterations.TOE() || right.iterations.TOE();
 
     if (left.IsNaN() || right.IsNaN()) {
-        if (left.iterations.TOE() || right.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Decimal::Signal(Decimal::STATUS_INVALID, left.iterations.TOE() || right.iterations.TOE(), "IEE754 special number arithmetic is disabled");
         tmp.SpecialClear();
         tmp.type = Decimal::NumType::_NAN;
         return tmp;
     }
     else if (left.IsInf() && right.IsInf()) {
-        if (left.iterations.TOE() || right.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Decimal::Signal(Decimal::STATUS_INVALID, left.iterations.TOE() || right.iterations.TOE(), "IEE754 special number arithmetic is disabled");
         if (left.sign != right.sign) {
             tmp.SpecialClear();
             tmp.type = Decimal::NumType::_NAN;
@@ -713,6 +1204,11 @@ Decimal operator*(const Decimal& left, const Decimal& right)
         return left; // or equivalently right
     }
 
+#ifdef __SIZEOF_INT128__
+    if (Decimal::MulInt128(left, right, tmp))
+        return tmp;
+#endif
+
     tmp=Decimal::Multiply(left,right);
     if( ((left.sign=='-')&& (right.sign=='-')) || ((left.sign=='+')&& (right.sign=='+')) )
         tmp.sign='+';
@@ -732,154 +1228,332 @@ Decimal operator*(const Decimal& left, const Decimal& right)
     return tmp;
 };
 
-
-Decimal Decimal::Divide(const Decimal& left, const Decimal& right)
+Decimal Decimal::MulFixed(const Decimal& left, const Decimal& right, int places)
 {
-    Decimal tmp(left.iterations);
-    tmp.type = Decimal::NumType::_NORMAL;
-    tmp.iterations.throw_on_error = left.iterations.TOE() || right.iterations.TOE();
+    int cut = left.decimals + right.decimals - places;
+    if (cut <= 0 || left.type != NumType::_NORMAL || right.type != NumType::_NORMAL)
+        return left * right;
 
-    Decimal Q(left.iterations) , R(left.iterations) , D(left.iterations) ,
-            N(left.iterations),  zero(left.iterations) ;
-    Q.type = Decimal::NumType::_NORMAL;
-    R.type = Decimal::NumType::_NORMAL;
-    D.type = Decimal::NumType::_NORMAL;
-    N.type = Decimal::NumType::_NORMAL;
-    zero = 0;
+    Decimal tmp = Decimal::MultiplyTrunc(left, right, cut);
+    tmp.iterations.throw_on_error = left.iterations.TOE() || right.iterations.TOE();
+    tmp.sign = (left.sign == right.sign) ? '+' : '-';
+    tmp.ShiftDecimalPoint(-places);
+    tmp.iterations.decimals = std::max(left.iterations.decimals, right.iterations.decimals);
+    tmp.LeadTrim();
+    tmp.TrailTrim();
+    if (tmp.number.size() == 1 && tmp.number[0] == '0')
+        tmp.sign = '+';
 
+    return tmp;
+}
 
-    N=left;
-    D=right;
-    R.sign='+';
+//Whether q, left/right rounded to the divisor's decimals, is exact.
+//q*right is then closer to left than a unit of left whenever right is
+//small enough, and equal to it when the digits that q*right has past
+//those of left are zero. These are the low digits of the product of the
+//low digits, which are few for an exact quotient: right must hold 2^k or
+//5^k to clear k of them.
+bool Decimal::ExactQuotient(const Decimal& left, const Decimal& right, const Decimal& q)
+{
+    if (q.IsZero())
+        return false;
+    int p = right.iterations.decimals;
+    int ints = static_cast<int>(right.number.size()) - right.decimals;
+    if (ints > p - left.decimals - 1)
+        return q * right == left;
 
-    int Ndiff = N.iterations.decimals - N.decimals;
-    int Ddiff = D.iterations.decimals - D.decimals;
-    while( (N.decimals!=0) || (D.decimals!=0) )
-    {
-        if(N.decimals==0)
-            N.number.push_front('0');
-        else
-            N.decimals--;
+    int k = q.decimals + right.decimals - left.decimals;
+    if (k <= 0)
+        return true;
+    size_t qz = 0, rz = 0;
+    while (q.number[qz] == '0')
+        qz++;
+    while (right.number[rz] == '0')
+        rz++;
+    int kk = k - static_cast<int>(qz + rz);
+    if (kk <= 0)
+        return true;
+    if (5 * kk > 17 * static_cast<int>(right.number.size() - rz) ||
+            (CharToInt(q.number[qz]) * CharToInt(right.number[rz])) % 10 != 0)
+        return false;
 
-        if(D.decimals==0)
-            D.number.push_front('0');
-        else
-            D.decimals--;
-    }
-    for (int i = 0; i < Ndiff; i++) {
-        N.number.push_front('0');
-        N.decimals++;
-    }
-    for (int i = 0; i < Ddiff; i++) {
-        D.number.push_front('0');
-        D.decimals++;
-    }
+    Decimal a, b;
+    a.type = b.type = NumType::_NORMAL;
+    a.number.assign(q.number.begin() + qz, q.number.begin() + std::min(q.number.size(), qz + kk));
+    b.number.assign(right.number.begin() + rz, right.number.begin() + std::min(right.number.size(), rz + kk));
+    a.LeadTrim();
+    b.LeadTrim();
+    Decimal low = Multiply(a, b);
+    for (int i = 0; i < kk; i++)
+        if (static_cast<size_t>(i) >= low.number.size() || low.number[i] != '0')
+            return false;
+    return true;
+}
 
-    N.LeadTrim();
-    D.LeadTrim();
+//Integers below this are handled by the machine-integer kernels: a digit
+//times one of them, plus a carry, stays within 64 bits.
+static const unsigned long long SMALL_INTEGER_LIMIT = 1000000000000000000ULL;
 
-    //Increase Precision to highest decimal quote
-    int div_precision = (left.iterations.decimals>right.iterations.decimals) ? (left.iterations.decimals) : (right.iterations.decimals) ;
-    int div_true_precision = (left.decimals>right.decimals) ? (left.decimals) : (right.decimals) ;
-    // int div_precision = div_true_precision;
-    for (size_t i=0; i < (size_t) div_true_precision ; i++)
-        N.number.push_front('0');
+Decimal Decimal::FromInteger(unsigned long long magnitude, bool negative)
+{
+    Decimal tmp;
+    tmp.type = NumType::_NORMAL;
+    tmp.sign = (negative && magnitude != 0) ? '-' : '+';
+    do {
+        tmp.number.push_back(IntToChar(magnitude % 10));
+        magnitude /= 10;
+    } while (magnitude != 0);
+    return tmp;
+}
 
-    int check= Decimal::CompareNum(xFD::Abs(N),xFD::Abs(D));
+//Adds the integer into the integer digits with a single carry or borrow
+//pass. False, leaving *this untouched, for special numbers and when the
+//sign would flip or the result would be zero, which the full addition
+//normalizes.
+bool Decimal::AddIntegerInPlace(unsigned long long magnitude, bool negative)
+{
+    if (type != NumType::_NORMAL || magnitude == 0 || magnitude >= SMALL_INTEGER_LIMIT)
+        return false;
 
-    if(check==0)
+    bool minus = sign == '-';
+    if (minus == negative)
     {
-        tmp.number.push_front('1');
-    }
-    if(check==2)
-    {
-        // It looks like this algo cannot handle when numerator < denominator,
-        // so this is a little "hack" to force it to work. 
-        if (N < 0_D && D < 0_D) {
-            N = xFD::Abs(N);
-            D = xFD::Abs(D);
+        unsigned long long carry = magnitude;
+        for (size_t i = decimals; carry != 0; ++i)
+        {
+            if (i == number.size())
+                number.push_back('0');
+            unsigned long long v = CharToInt(number[i]) + carry;
+            number[i] = IntToChar(v % 10);
+            carry = v / 10;
         }
+        return true;
+    }
 
-        if (N < 0_D) {
-            return Decimal::Divide(N-D, D) + 1_D;
-        }
-        else if (D < 0_D) {
-            D = -D;
-            return -(Decimal::Divide(N+D, D) - 1_D);
-        }
-        else {
-            return Decimal::Divide(N+D, D) - 1_D;
+    if (CompareInteger(magnitude, minus) * (minus ? -1 : 1) <= 0)
+        return false;
+    unsigned long long borrow = magnitude;
+    for (size_t i = decimals; borrow != 0; ++i)
+    {
+        int d = CharToInt(number[i]);
+        int sub = static_cast<int>(borrow % 10);
+        borrow /= 10;
+        if (d < sub)
+        {
+            d += 10;
+            borrow++;
         }
+        number[i] = IntToChar(d - sub);
     }
-    else
+    LeadTrim();
+    return true;
+}
+
+void Decimal::AddSmallInPlace(unsigned long long magnitude, bool negative)
+{
+    if (!AddIntegerInPlace(magnitude, negative))
+        *this = *this + FromInteger(magnitude, negative);
+}
+
+Decimal Decimal::AddSmall(const Decimal& left, unsigned long long magnitude, bool negative)
+{
+    Decimal tmp = left;
+    tmp.AddSmallInPlace(magnitude, negative);
+    return tmp;
+}
+
+//Single pass of digit times integer plus carry.
+Decimal Decimal::MulSmall(const Decimal& left, unsigned long long magnitude, bool negative)
+{
+    if (left.type != NumType::_NORMAL || magnitude == 0 || magnitude >= SMALL_INTEGER_LIMIT || left.IsZero())
+        return left * FromInteger(magnitude, negative);
+
+    Decimal tmp = left;
+    unsigned long long carry = 0;
+    for (size_t i = 0; i < tmp.number.size(); ++i)
     {
-        N= xFD::Abs(N);
-        D= xFD::Abs(D);
-        while(!N.number.empty())
-        {
-            R.number.push_front(*(N.number.rbegin()));
-            N.number.pop_back();
+        unsigned long long v = CharToInt(tmp.number[i]) * magnitude + carry;
+        tmp.number[i] = IntToChar(v % 10);
+        carry = v / 10;
+    }
+    for (; carry != 0; carry /= 10)
+        tmp.number.push_back(IntToChar(carry % 10));
+    tmp.sign = ((tmp.sign == '-') == negative) ? '+' : '-';
+    tmp.iterations.decimals = std::max(left.iterations.decimals, DecimalIterations().decimals);
+    tmp.LeadTrim();
+    tmp.TrailTrim();
+    return tmp;
+}
 
-            bool is_zero=true;
-            std::deque<char>::const_iterator zero_iter = R.number.begin();
-            for(;zero_iter!= R.number.end();++zero_iter)
-                if(*zero_iter!='0')
-                    is_zero=false;
+//Short division from the top digit, exactly rounded to the decimals of
+//the integer's default iterations like any quotient by Decimal(right).
+Decimal Decimal::DivSmall(const Decimal& left, unsigned long long magnitude, bool negative)
+{
+    DecimalIterations its;
+    int p = its.decimals;
+    if (left.type != NumType::_NORMAL || magnitude == 0 || magnitude >= SMALL_INTEGER_LIMIT ||
+            left.decimals > p + 1 || left.IsZero())
+        return left / FromInteger(magnitude, negative);
+
+    Decimal tmp = left;
+    tmp.number.insert(tmp.number.begin(), p + 1 - left.decimals, '0');
+    tmp.decimals = p + 1;
+    unsigned long long rem = 0;
+    for (auto it = tmp.number.rbegin(); it != tmp.number.rend(); ++it)
+    {
+        unsigned long long cur = rem * 10 + CharToInt(*it);
+        *it = IntToChar(cur / magnitude);
+        rem = cur % magnitude;
+    }
+    if (rem != 0)
+        status_flags |= STATUS_INEXACT;
+    tmp.LeadTrim();
+    tmp.sign = ((tmp.sign == '-') == negative) ? '+' : '-';
+    tmp.iterations.decimals = std::max(left.iterations.decimals, p);
+    tmp.RoundTo(p, its.trunc_not_round ? ROUND_DOWN : ROUND_HALF_UP);
+    tmp.TrailTrim();
+    if (tmp.IsZero())
+        tmp.sign = '+';
+    return tmp;
+}
 
-            if((R>=D) && (!is_zero))
-            {
-                int Q_sub=0;
-                int min=0;
-                int max = 9;
+Decimal Decimal::Sqr(const Decimal& x)
+{
+    Decimal tmp = Decimal::Square(x);
+    tmp.sign = '+';
+    tmp.decimals = 2 * x.decimals;
+    tmp.iterations.decimals = x.iterations.decimals;
+    tmp.LeadTrim();
+    tmp.TrailTrim();
+    return tmp;
+}
 
-                while( R >= D)
-                {
-                    int avg = max-min;
-                    int mod_avg = avg / 2;
-                    avg= (avg - mod_avg * 2) ? (mod_avg + 1) : (mod_avg);
-
-                    int div_check = Decimal::CompareNum ( R, D*avg );
-
-                    if (div_check == 2)
-                    {
-                        max = avg;
-                    }
-                    else
-                    {
-                        Q_sub = Q_sub + avg;
-                        R = R - D * avg;
-
-                        max = 9;
-                    }
-                }
+Decimal Decimal::MulTrunc(const Decimal& left, const Decimal& right, int digits)
+{
+    if (left.type != NumType::_NORMAL || right.type != NumType::_NORMAL)
+        return left * right;
+
+    // Position of the most significant non-zero digit of each operand;
+    // the product's leading digit sits at their sum or one above it.
+    int top_left = static_cast<int>(left.number.size()) - 1;
+    while (top_left >= 0 && left.number[top_left] == '0')
+        top_left--;
+    int top_right = static_cast<int>(right.number.size()) - 1;
+    while (top_right >= 0 && right.number[top_right] == '0')
+        top_right--;
+    if (top_left < 0 || top_right < 0)
+        return left * right;
+
+    int cut = top_left + top_right + 1 - digits;
+    return Decimal::MulFixed(left, right, left.decimals + right.decimals - cut);
+}
 
-		int modnum = Q_sub / 10;
-		std::deque<char> staging;
-		while (modnum > 0) {
-			staging.push_front(modnum % 10);
-			modnum /= 10;
-		}
-		for (auto it = staging.rbegin(); it != staging.rend(); it++) {
-			Q.number.push_front(Decimal::IntToChar(*it));
-		}
-                Q.number.push_front(Decimal::IntToChar(Q_sub % 10));
-
-                bool is_zero=true;
-                std::deque<char>::const_iterator zero_iter = R.number.begin();
-                for(;zero_iter!= R.number.end();++zero_iter)
-                    if(*zero_iter!='0')
-                        is_zero=false;
-                if(is_zero)
-                    R.number.clear();
+Decimal Decimal::Fma(const Decimal& a, const Decimal& b, const Decimal& c)
+{
+    if (a.IsNaN() || b.IsNaN() || c.IsNaN() || a.IsInf() || b.IsInf() || c.IsInf()) {
+        Signal(STATUS_INVALID, a.iterations.TOE() || b.iterations.TOE() || c.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return a*b + c;
+    }
+
+    int places = std::max(a.iterations.decimals, std::max(b.iterations.decimals, c.iterations.decimals));
+    int dec = std::max(a.decimals + b.decimals, c.decimals);
+    size_t poff = dec - (a.decimals + b.decimals);
+    size_t coff = dec - c.decimals;
+    size_t la = a.number.size(), lb = b.number.size(), lc = c.number.size();
+    size_t n = std::max(la + lb + poff, lc + coff) + 1;
+
+    // Signed columns: the addend goes in first, the partial products are
+    // summed on top of it and everything is normalized once at the end.
+    std::vector<int64_t> acc(n, 0);
+    int64_t csign = (c.sign == '-') ? -1 : 1;
+    for (size_t k = 0; k < lc; k++)
+        acc[k + coff] = csign * CharToInt(c.number[k]);
+    int64_t psign = (a.sign == b.sign) ? 1 : -1;
+    for (size_t i = 0; i < la; i++) {
+        int64_t da = psign * CharToInt(a.number[i]);
+        if (da == 0)
+            continue;
+        for (size_t j = 0; j < lb; j++)
+            acc[i + j + poff] += da * CharToInt(b.number[j]);
+    }
 
-            }
-            else
-            {
-                Q.number.push_front('0');
+    int64_t carry = 0;
+    for (size_t k = 0; k < n; k++) {
+        int64_t v = acc[k] + carry;
+        carry = v / 10;
+        v %= 10;
+        if (v < 0) {
+            v += 10;
+            carry--;
+        }
+        acc[k] = v;
+    }
+
+    Decimal tmp(a.iterations);
+    tmp.type = NumType::_NORMAL;
+    tmp.sign = '+';
+    tmp.decimals = dec;
+    tmp.iterations.decimals = places;
+    // A negative sum leaves a borrow out of the top column, the digits then
+    // hold its ten's complement.
+    if (carry < 0) {
+        tmp.sign = '-';
+        bool borrow = false;
+        for (size_t k = 0; k < n; k++) {
+            if (borrow)
+                acc[k] = 9 - acc[k];
+            else if (acc[k] != 0) {
+                acc[k] = 10 - acc[k];
+                borrow = true;
             }
         }
-        tmp = Q;
     }
+    for (size_t k = 0; k < n; k++)
+        tmp.number.push_back(IntToChar(acc[k]));
+    tmp.LeadTrim();
+    tmp.RoundTo(places, tmp.iterations.trunc_not_round ? ROUND_DOWN : ROUND_HALF_UP);
+    tmp.TrailTrim();
+    if (tmp.number.size() == 1 && tmp.number[0] == '0')
+        tmp.sign = '+';
+    return tmp;
+}
+
+
+Decimal Decimal::Divide(const Decimal& left, const Decimal& right)
+{
+    Decimal tmp(left.iterations);
+    tmp.type = Decimal::NumType::_NORMAL;
+
+    if (right.IsZero())
+    {
+        Signal(STATUS_DIVISION_BY_ZERO, left.iterations.TOE() || right.iterations.TOE(), "Division by 0");
+        tmp.SpecialClear();
+        tmp.type = Decimal::NumType::_INFINITY;
+        tmp.sign = left.sign;
+        return tmp;
+    }
+
+    //Increase Precision to highest decimal quote
+    int div_precision = (left.iterations.decimals>right.iterations.decimals) ? (left.iterations.decimals) : (right.iterations.decimals) ;
+
+    // Scale both operands to integers N and D such that
+    // N / D = |left / right| * 10^div_precision, then the
+    // integer quotient holds exactly div_precision decimals.
+    Decimal N = left, D = right, R;
+    int shift = right.decimals + div_precision - left.decimals;
+    N.decimals = 0;
+    D.decimals = 0;
+    if (shift > 0)
+        N.ShiftDecimalPoint(shift);
+    else if (shift < 0)
+        D.ShiftDecimalPoint(-shift);
+    N.LeadTrim();
+    D.LeadTrim();
+
+    Decimal::DivModNum(N, D, tmp, R);
+    if (!R.IsZero())
+        status_flags |= STATUS_INEXACT;
+    tmp.iterations.throw_on_error = left.iterations.TOE() || right.iterations.TOE();
 
     if( ((left.sign=='-')&& (right.sign=='-')) || ((left.sign=='+')&& (right.sign=='+')) )
         tmp.sign='+';
@@ -888,64 +1562,91 @@ Decimal Decimal::Divide(const Decimal& left, const Decimal& right)
 
     tmp.decimals = div_precision;
     tmp.iterations.decimals = div_precision;
+    if (tmp.number.size() <= static_cast<size_t>(div_precision))
+        tmp.number.insert(tmp.number.end(), div_precision - tmp.number.size() + 1, '0');
     tmp.LeadTrim();
     tmp.TrailTrim();
+    if (tmp.number.size() == 1 && tmp.number[0] == '0')
+        tmp.sign = '+';
 
     return tmp;
 };
 
 Decimal operator/(const Decimal& left, const Decimal& right) {
     Decimal tmp(left.iterations);
-    if (left.IsNaN() || right.IsNaN() ||  (left == 0_D && right == 0_D) || (left.IsInf() && right.IsInf())) {
-        if (left.iterations.TOE() || right.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+    if (left.IsNaN() || right.IsNaN() ||  (left.IsZero() && right.IsZero()) || (left.IsInf() && right.IsInf())) {
+        Decimal::Signal(Decimal::STATUS_INVALID, left.iterations.TOE() || right.iterations.TOE(), "IEE754 special number arithmetic is disabled");
         tmp.SpecialClear();
         tmp.type = Decimal::NumType::_NAN;
         return tmp;
     }
     else if (right.IsInf()) {
-        if (left.iterations.TOE() || right.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Decimal::Signal(0, left.iterations.TOE() || right.iterations.TOE(), "IEE754 special number arithmetic is disabled");
         tmp = 0;
         tmp.type = Decimal::NumType::_NORMAL;
         return tmp;
     }
-    else if (right == 0_D)
+    else if (right.IsZero())
     {
-        if (tmp.iterations.TOE()) {
-            throw DecimalIllegalOperation("Division by 0");
-        }
-        else {
-            tmp.SpecialClear();
-            tmp.type = Decimal::NumType::_INFINITY;
-            return tmp;
-        }
+        Decimal::Signal(Decimal::STATUS_DIVISION_BY_ZERO, tmp.iterations.TOE(), "Division by 0");
+        tmp.SpecialClear();
+        tmp.type = Decimal::NumType::_INFINITY;
+        return tmp;
     }
-    else if (left == 0_D) {
+    else if (left.IsZero()) {
         return 0_D;
     }
 
     if (right.iterations.decimals > 0) {
-        Decimal X = Decimal::Divide(1_D, right);
-
-        // The output from the "Divide" method is almost accurate
-        // but is in rare cases, several decimals off-precision.
-        // Newton-Rhapson iteraton will set all the integers right.
-        //
-        // Keep trimming the decimal places, so that it doesn't grow
-        // monstrously.
-        for (int i = 0; i < right.iterations.div; i++) {
-            X = X*(2_D - right*X);
-            while (X.decimals > right.iterations.decimals) {
-                X.decimals--;
-                X.number.pop_front();
+#ifdef __SIZEOF_INT128__
+        // Small operands get the exactly rounded quotient natively.
+        if (Decimal::DivInt128(left, right, tmp))
+            return tmp;
+#endif
+        Decimal X;
+        double m, lm;
+        int e, le;
+        if (right.iterations.div > 0 && right.LeadApprox(m, e)) {
+            // 1/right from its leading digits is good to about 15 digits,
+            // each Newton-Rhapson step then doubles them. X carries as many
+            // extra decimals as left has integer digits, so that left*X
+            // is still right to the last place, and right*X as many more
+            // as X has integer digits.
+            int p = right.iterations.decimals;
+            int places = p + 4 + (left.LeadApprox(lm, le) ? std::max(0, le + 1) : 0);
+            int inner = places + std::max(0, 1 - e);
+            int steps = 1;
+            for (int digits = 15; digits < places - e + 1; digits *= 2)
+                steps++;
+            X = Decimal::FromApprox(1.0 / m, -e, right.iterations);
+            for (int i = 0; i < steps; i++) {
+                X = Decimal::MulFixed(X, 2_D - Decimal::MulFixed(right, X, inner), places);
             }
-        }
+
+            unsigned status = status_flags;
+            Decimal res = Decimal::MulFixed(left, X, p + 2);
+            int tail = 0;
+            for (int i = res.decimals - p; i-- > 0; )
+                tail = tail * 10 + Decimal::CharToInt(res.number[i]);
+            for (int i = res.decimals - p; i < 2; i++)
+                tail *= 10;
+            res.RoundTo(p, res.iterations.trunc_not_round ? Decimal::ROUND_DOWN : Decimal::ROUND_HALF_UP);
+            res.TrailTrim();
+            if (res.number.size() == 1 && res.number[0] == '0')
+                res.sign = '+';
+            // X is a few units off in the last places, so the two extra
+            // digits can't tell an exact quotient: it arrives with a tail
+            // like 99, 00 or 01. Only those tails need a closer look.
+            status_flags = status;
+            if ((tail > 5 && tail < 95) || !Decimal::ExactQuotient(left, right, res))
+                status_flags |= Decimal::STATUS_INEXACT;
+            return res;
+        }
+
+        X = Decimal::Divide(1_D, right);
+        X.RoundTo(right.iterations.decimals,
+                X.iterations.trunc_not_round ? Decimal::ROUND_DOWN : Decimal::ROUND_HALF_UP);
         X.TrailTrim();
-        X = (X.iterations.trunc_not_round) ? xFD::Floor(X) : 
-            xFD::Round(X, -right.iterations.decimals);
 
         Decimal res = left*X;
         res.TrailTrim();
@@ -958,352 +1659,377 @@ Decimal operator/(const Decimal& left, const Decimal& right) {
 
 Decimal operator%(const Decimal& left, const Decimal& right)
 {
-    Decimal tmp(left.iterations);
-    tmp.type = Decimal::NumType::_NORMAL;
-    tmp.iterations.throw_on_error = left.iterations.TOE() || right.iterations.TOE();
-
-    if( (left.decimals!=0) || (right.decimals!=0) )
-    {
-        throw DecimalIllegalOperation("Modulus between non-integers");
-    }
-
-    if (left.IsNaN() || right.IsNaN() || (left == 0_D && right == 0_D) || (left.IsInf() && right.IsInf())) {
-        if (left.iterations.TOE() || right.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
-        tmp.SpecialClear();
-        tmp.type = Decimal::NumType::_NAN;
-        return tmp;
-    }
-
-
-    if (right == 0_D)
-    {
-        if (tmp.iterations.throw_on_error) {
-            throw DecimalIllegalOperation("Modulus by 0");
-        }
-        else {
-            tmp.SpecialClear();
-            tmp.type = Decimal::NumType::_NAN;
-            return tmp;
-        }
-    }
-
-    Decimal left_ = left, right_ = right;
-    DecimalIterations its;
-    left_.iterations = its;
-    right_.iterations = its;
-
-    // 416984806968863648079 % 16
-    // is broken, check in debugger.
-    // check hex 458479643868196418248935325987194
-    Decimal Q = left / right;
-    // Obtain the fractional part and multiply it by `right`
-    // to get the mod number.
-    // The result should be an integer or ridiculously
-    // close to one.
-    Decimal res = xFD::Round((Q - xFD::Floor(Q)) * right);
-    res.TrailTrim();
-    res.iterations = left.iterations;
-
-    if (res == 0_D) {
-        auto divres = left / right;
-         if (xFD::Floor(divres) != divres) {
-            // The calculation must have overflown. Try again with the unsafe version
-            // which is good at calculating mod of huge numbers
-            return xFD::Mod(left, right);
-         }
-        return res;
-    }
-    else {
-        return res;
-    }
+    Decimal remainder;
+    Decimal::DivMod(left, right, remainder);
+    return remainder;
 }
 
-// UNSAFE. INTERNAL USE ONLY.
+// Kept for compatibility, this is the same as operator%.
 Decimal Decimal::Mod(const Decimal& left, const Decimal& right)
+{
+    return left % right;
+}
+
+Decimal Decimal::DivMod(const Decimal& left, const Decimal& right, Decimal& remainder)
 {
     Decimal tmp(left.iterations);
     tmp.type = Decimal::NumType::_NORMAL;
     tmp.iterations.throw_on_error = left.iterations.TOE() || right.iterations.TOE();
+
     if( (left.decimals!=0) || (right.decimals!=0) )
     {
-        throw DecimalIllegalOperation("Modulus between non-integers");
-    }
-
-    Decimal Q(left.iterations) , R(left.iterations) , D(left.iterations) , N(left.iterations), 
-            zero(left.iterations), ret(left.iterations);
-    Q.type = Decimal::NumType::_NORMAL;
-    R.type = Decimal::NumType::_NORMAL;
-    D.type = Decimal::NumType::_NORMAL;
-    N.type = Decimal::NumType::_NORMAL;
-    ret.type = Decimal::NumType::_NORMAL;
-    zero = 0;
-    if (left.IsNaN() || right.IsNaN() || (left == 0_D && right == 0_D) || (left.IsInf() && right.IsInf())) {
-        if (left.iterations.TOE() || right.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, tmp.iterations.TOE(), "Modulus between non-integers");
         tmp.SpecialClear();
         tmp.type = Decimal::NumType::_NAN;
+        remainder = tmp;
         return tmp;
     }
 
-
-    if (right == zero)
-    if (right == 0_D)
-    {
-        if (tmp.iterations.throw_on_error) {
-            throw DecimalIllegalOperation("Modulus by 0");
-        }
-        else {
-            tmp.SpecialClear();
-            tmp.type = Decimal::NumType::_NAN;
-            return tmp;
-        }
+    if (left.IsNaN() || right.IsNaN() || (left.IsZero() && right.IsZero()) || left.IsInf() || right.IsInf()) {
+        Signal(STATUS_INVALID, left.iterations.TOE() || right.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        tmp.SpecialClear();
+        tmp.type = Decimal::NumType::_NAN;
+        remainder = tmp;
+        return tmp;
     }
 
-    N= ( left>zero ) ? (left) : (left * (-1)) ;
-    D= ( right>zero ) ? (right) : (right* (-1)) ;
-    R.sign='+';
-
-    int check= Decimal::CompareNum(N,D);
-
-    if(check==0)
+    if (right.IsZero())
     {
-        return zero;
-    }
-    if(check==2)
-    {
-        return left;
+        Signal(STATUS_INVALID, tmp.iterations.TOE(), "Modulus by 0");
+        tmp.SpecialClear();
+        tmp.type = Decimal::NumType::_NAN;
+        remainder = tmp;
+        return tmp;
     }
-    else
-    {
-        while(!N.number.empty())
-        {
-            R.number.push_front(*(N.number.rbegin()));
-            N.number.pop_back();
 
-            bool is_zero=true;
-            std::deque<char>::const_iterator zero_iter = R.number.begin();
-            for(;zero_iter!= R.number.end();++zero_iter)
-                if(*zero_iter!='0')
-                    is_zero=false;
-
-            if((R>=D) && (!is_zero))
-            {
-                int Q_sub=0;
-                int min=0;
-                int max = 9;
-
-                while( R >= D)
-                {
-                    int avg = max-min;
-                    int mod_avg = avg / 2;
-                    avg= (avg - mod_avg * 2) ? (mod_avg + 1) : (mod_avg);
-
-                    int div_check = Decimal::CompareNum ( R, D*avg );
-
-                    if (div_check == 2)
-                    {
-                        max = avg;
-                    }
-                    else
-                    {
-                        Q_sub = Q_sub + avg;
-                        R = R - D * avg;
-
-                        max = 9;
-                    }
-                }
-
-		int modnum = Q_sub / 10;
-		std::deque<char> staging;
-		while (modnum > 0) {
-			staging.push_front(modnum % 10);
-			modnum /= 10;
-		}
-		for (auto it = staging.rbegin(); it != staging.rend(); it++) {
-			Q.number.push_front(Decimal::IntToChar(*it));
-		}
-                Q.number.push_front(Decimal::IntToChar(Q_sub % 10));
-                ret = R;
-
-                bool is_zero=true;
-                std::deque<char>::const_iterator zero_iter = R.number.begin();
-                for(;zero_iter!= R.number.end();++zero_iter)
-                    if(*zero_iter!='0')
-                        is_zero=false;
-                if(is_zero)
-                    R.number.clear();
-            }
-            else
-            {
-                ret = R;
-                Q.number.push_front('0');
-            }
-        }
-
-        Q.LeadTrim();
-        ret.LeadTrim();
-        tmp = ret;
-    }
+    Decimal::DivModNum(left, right, tmp, remainder);
+    tmp.iterations.throw_on_error = left.iterations.TOE() || right.iterations.TOE();
+    remainder.iterations = tmp.iterations;
 
     if( ((left.sign=='-')&& (right.sign=='-')) || ((left.sign=='+')&& (right.sign=='+')) )
         tmp.sign='+';
     else
         tmp.sign='-';
+    remainder.sign = left.sign;
 
-    if(!Decimal::CompareNum(tmp,zero))
-        tmp.sign='+';
+    if (tmp.number.size() == 1 && tmp.number[0] == '0')
+        tmp.sign = '+';
+    if (remainder.number.size() == 1 && remainder.number[0] == '0')
+        remainder.sign = '+';
 
     return tmp;
 }
 
+DecimalModulus::DecimalModulus(const Decimal& modulus)
+{
+    if (modulus.IsNaN() || modulus.IsInf() || !modulus.IsInt() || modulus.sign != '+' || modulus.IsZero()) {
+        Decimal::Signal(Decimal::STATUS_INVALID, true, "Modulus must be a positive integer");
+    }
+    m = modulus;
+    m.LeadTrim();
+    k = m.number.size();
+
+    Decimal b2k(m.iterations);
+    b2k.type = Decimal::NumType::_NORMAL;
+    b2k.number.assign(2*k, '0');
+    b2k.number.push_back('1');
+    Decimal r;
+    Decimal::DivModNum(b2k, m, mu, r);
+    mu.sign = '+';
+}
 
-Decimal Decimal::Factorial(const Decimal& x) {
+Decimal DecimalModulus::Reduce(const Decimal& x) const
+{
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Decimal::Signal(Decimal::STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return Decimal::NaN();
+    }
+    if (!x.IsInt()) {
+        Decimal::Signal(Decimal::STATUS_INVALID, x.iterations.TOE(), "Modulus between non-integers");
+        return Decimal::NaN();
+    }
+
+    Decimal r;
+    if (x.number.size() > 2*k) {
+        Decimal::DivMod(x, m, r);
+        if (r.IsNegative()) {
+            r += m;
+        }
+        return r;
+    }
+
+    r = x;
+    r.sign = '+';
+    r.LeadTrim();
+    if (r.number.size() >= k) {
+        // q = floor(floor(x / 10^(k-1)) * mu / 10^(k+1)) undershoots the
+        // true quotient by a few units at most.
+        Decimal q1 = r;
+        q1.number.erase(q1.number.begin(), q1.number.begin() + (k-1));
+        Decimal q = Decimal::MultiplyTrunc(q1, mu, k+1);
+        q.LeadTrim();
+        r = Decimal::Subtract(r, Decimal::Multiply(q, m));
+        r.LeadTrim();
+    }
+    while (Decimal::CompareNum(r, m) != 2) {
+        r = Decimal::Subtract(r, m);
+        r.LeadTrim();
+    }
+    r.sign = '+';
+    r.iterations = x.iterations;
+    if (x.sign == '-' && !r.IsZero()) {
+        r = Decimal::Subtract(m, r);
+        r.LeadTrim();
+        r.sign = '+';
     }
-    if (x.decimals > 0 || x < 0) {
-        throw DecimalIllegalOperation("Factorial is only allowed for positive integers");
-    }
-    Decimal r(1), i(1);
-    while (i < x) {
-        r *= i;
-        i++;
+    return r;
+}
+
+Decimal DecimalModulus::MulMod(const Decimal& x, const Decimal& y) const
+{
+    return Reduce(Reduce(x) * Reduce(y));
+}
+
+Decimal DecimalModulus::AddMod(const Decimal& x, const Decimal& y) const
+{
+    Decimal r = Reduce(x) + Reduce(y);
+    if (r >= m) {
+        r -= m;
     }
     return r;
+}
 
+DecimalInt::DecimalInt(long long x)
+{
+    v.type = Decimal::NumType::_NORMAL;
+    v.sign = (x < 0) ? '-' : '+';
+    unsigned long long u = (x < 0) ? -static_cast<unsigned long long>(x) : x;
+    do {
+        v.number.push_back(Decimal::IntToChar(u % 10));
+        u /= 10;
+    } while (u != 0);
 }
 
-Decimal Decimal::Floor(const Decimal& x) {
-    auto y = x;
-    // Shed all decimals numbers and then replace them with zeroes.
-    for (int d = x.decimals; d > 0; d--) {
-        y.number.pop_front();
+DecimalInt::DecimalInt(const Decimal& x) : DecimalInt(Decimal(x))
+{
+}
+
+DecimalInt::DecimalInt(Decimal&& x) : v(std::move(x))
+{
+    if (v.IsNaN() || v.IsInf()) {
+        Decimal::Signal(Decimal::STATUS_INVALID, true, "IEE754 special numbers are not integers");
     }
-    for (int d = 0; d < x.decimals; d++) {
-        y.number.push_front('0');
+    v.TrailTrim();
+    if (v.decimals != 0) {
+        Decimal::Signal(Decimal::STATUS_INVALID, true, "Integer conversion of a non-integer");
     }
-    y.TrailTrim();
-    return y;
+    Normalize();
 }
 
-Decimal Decimal::Round(const Decimal& x, int places) {
-    --places; // To get the true rounding behavior.
-    auto y = x;
-    y.TrailTrim();
-    y.LeadTrim();
-    int add_ints = 0;
-    int add_decs = 0;
-    int chop_limit = places + y.decimals;
-    int force_zero = false;
-    if (chop_limit < 0) {
-        return x;
-    }
-    else if (static_cast<size_t>(chop_limit) >= y.number.size()) {
-        return 0_D; // An n-digit number cannot possibly have >=5
-                    // in the n+1st decimal place.
+void DecimalInt::Normalize()
+{
+    v.LeadTrim();
+    if (IsZero())
+        v.sign = '+';
+}
+
+DecimalInt& DecimalInt::MulAdd(uint64_t m, uint64_t a)
+{
+    uint64_t carry = a;
+    for (size_t i = 0; i < v.number.size(); i++) {
+        uint64_t aus = Decimal::CharToInt(v.number[i]) * m + carry;
+        v.number[i] = Decimal::IntToChar(aus % 10);
+        carry = aus / 10;
     }
-    else if (static_cast<size_t>(chop_limit) == y.number.size()-1 ||
-            (y.Ints() == 1 && y.number[chop_limit] == '0' && static_cast<size_t>(chop_limit) == y.number.size()-2)) {
-        int chop_index = chop_limit;
-        if (y.Ints() == 1 && y.number[chop_limit] == '0') {
-            force_zero = true;
-        }
-        if (y.number[chop_index] >= '5') {
-            y.number.clear();
-            if (force_zero) {
-                y.number.push_front('0');
-            }
-            y.number.push_front('1');
-            for (int i = 0; i <= chop_index; i++) {
-                y.number.push_front('0');
-            }
-            y.TrailTrim();
-            return y;
-        }
-        else {
-            return 0_D;
-        }
+    while (carry != 0) {
+        v.number.push_back(Decimal::IntToChar(carry % 10));
+        carry /= 10;
     }
+    Normalize();
+    return *this;
+}
 
-    // We are asked to round something within range.
-    // Chop off everything below the limit
-    for (int i = 0; i < chop_limit; i++) {
-        y.number.pop_front();
-        if (y.decimals > 0) {
-            --y.decimals;
-            ++add_decs;
-        }
-        else {
-            ++add_ints;
-        }
+uint64_t DecimalInt::DivSmall(uint64_t d)
+{
+    if (d == 0) {
+        Decimal::Signal(Decimal::STATUS_DIVISION_BY_ZERO, true, "Division by 0");
+    }
+    uint64_t rem = 0;
+    for (size_t i = v.number.size(); i-- > 0; ) {
+        uint64_t aus = rem * 10 + Decimal::CharToInt(v.number[i]);
+        v.number[i] = Decimal::IntToChar(aus / d);
+        rem = aus % d;
     }
+    Normalize();
+    return rem;
+}
 
+DecimalInt DecimalInt::operator-() const
+{
+    DecimalInt tmp = *this;
+    if (!tmp.IsZero())
+        tmp.v.sign = (v.sign == '-') ? '+' : '-';
+    return tmp;
+}
 
-    bool add1 = false;
-    if (y.number[0] >= '5') {
-        add1 = true;
+DecimalInt DecimalInt::Add(const DecimalInt& left, const DecimalInt& right)
+{
+    DecimalInt tmp;
+    if (left.v.sign == right.v.sign) {
+        tmp.v.number = Decimal::Sum(left.v, right.v).number;
+        tmp.v.sign = left.v.sign;
+        return tmp;
     }
-    
-    y.number.pop_front();
-    if (y.decimals > 0) {
-        --y.decimals;
-        ++add_decs;
+    int check = Decimal::CompareNum(left.v, right.v);
+    if (check == 0)
+        return tmp;
+    if (check == 1) {
+        tmp.v.number = Decimal::Subtract(left.v, right.v).number;
+        tmp.v.sign = left.v.sign;
     }
     else {
-        ++add_ints;
+        tmp.v.number = Decimal::Subtract(right.v, left.v).number;
+        tmp.v.sign = right.v.sign;
     }
+    tmp.Normalize();
+    return tmp;
+}
 
-    if (add1) {
-        if (y.number[0] > '9') {
-            if (y.number.size() > 0) {
-                ++y.number[1];
-            }
-            else {
-                y.number.push_back('1');
-            }
-        }
-        else {
-            ++y.number[0];
-        }
-        add1 = false;
-    }
+DecimalInt DecimalInt::Mul(const DecimalInt& left, const DecimalInt& right)
+{
+    DecimalInt tmp;
+    tmp.v.number = (&left == &right) ? Decimal::Square(left.v).number
+                                     : Decimal::Multiply(left.v, right.v).number;
+    tmp.v.sign = (left.v.sign == right.v.sign) ? '+' : '-';
+    tmp.Normalize();
+    return tmp;
+}
+
+DecimalInt DecimalInt::DivMod(const DecimalInt& left, const DecimalInt& right, DecimalInt& remainder)
+{
+    if (right.IsZero()) {
+        Decimal::Signal(Decimal::STATUS_DIVISION_BY_ZERO, true, "Division by 0");
+    }
+    DecimalInt q;
+    remainder = DecimalInt();
+    Decimal::DivModNum(left.v, right.v, q.v, remainder.v);
+    q.v.type = remainder.v.type = Decimal::NumType::_NORMAL;
+    q.v.decimals = remainder.v.decimals = 0;
+    q.v.sign = (left.v.sign == right.v.sign) ? '+' : '-';
+    remainder.v.sign = left.v.sign;
+    q.Normalize();
+    remainder.Normalize();
+    return q;
+}
 
+int DecimalInt::Compare(const DecimalInt& left, const DecimalInt& right)
+{
+    if (left.v.sign != right.v.sign)
+        return (left.v.sign == '-') ? -1 : 1;
+    int check = Decimal::CompareNum(left.v, right.v);
+    if (check == 0)
+        return 0;
+    int r = (check == 1) ? 1 : -1;
+    return (left.v.sign == '-') ? -r : r;
+}
 
+DecimalSeries::Split DecimalSeries::Evaluate(unsigned long n1, unsigned long n2) const
+{
+    if (n1 >= n2) {
+        Decimal::Signal(Decimal::STATUS_INVALID, true, "Empty series range");
+    }
+    Split s;
+    if (n2 - n1 == 1) {
+        s.P = p(n1);
+        s.Q = q(n1);
+        s.T = a(n1) * s.P;
+        return s;
+    }
+    unsigned long m = n1 + (n2 - n1) / 2;
+    Split l = Evaluate(n1, m);
+    Split r = Evaluate(m, n2);
+    s.T = l.T * r.Q + l.P * r.T;
+    s.P = l.P * r.P;
+    s.Q = l.Q * r.Q;
+    return s;
+}
 
-    for (int i = 0; i < add_ints; i++) {
-        y.number.push_front('0');
+Decimal DecimalSeries::Sum(unsigned long terms, const DecimalIterations& iterations) const
+{
+    if (terms == 0) {
+        return Decimal(0)(iterations);
+    }
+    Split s = Evaluate(0, terms);
+    return std::move(s.T).ToDecimal()(iterations) / std::move(s.Q).ToDecimal()(iterations);
+}
+
+
+Decimal Decimal::Factorial(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
-    if (places < 0) {
-        y.decimals = -(places+1);
+    if (x.decimals > 0 || x < 0) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "Factorial is only allowed for positive integers");
+        return NaN();
     }
-    else {
-        y.decimals = 0;
+    unsigned long n = x.ToULong64();
+    DecimalInt r(1);
+    for (unsigned long i = 2; i <= n; i++) {
+        r.MulAdd(i, 0);
     }
+    Decimal res = std::move(r).ToDecimal();
+    res.iterations = x.iterations;
+    return res;
+}
 
-    for (size_t i = 0; i < y.number.size(); i++) {
-        if (y.number[i] > '9') {
-            if (i+1 < y.number.size()) {
-                ++y.number[i+1];
-            }
-            else {
-                y.number.push_back('1');
-            }
-            y.number[i] = '0';
-        }
-        else {
-            break;
-        }
-    }
-     
+Decimal Decimal::Floor(const Decimal& x) {
+    auto y = x;
+    y.RoundTo(0, ROUND_FLOOR);
+    return y;
+}
+
+Decimal Decimal::Ceil(const Decimal& x) {
+    auto y = x;
+    y.RoundTo(0, ROUND_CEILING);
+    return y;
+}
+
+Decimal Decimal::Round(const Decimal& x, int places, RoundingMode mode) {
+    auto y = x;
+    y.RoundTo(-places, mode);
     y.TrailTrim();
     return y;
 }
 
+Decimal Decimal::ScaleB10(const Decimal& x, int k) {
+    Decimal y = x;
+    y.ShiftDecimalPoint(k);
+    return y;
+}
+
+Decimal Decimal::Modf(const Decimal& x, Decimal& ipart) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(x.IsNaN() ? STATUS_INVALID : 0, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        ipart = x;
+        return x.IsNaN() ? x : Decimal(0_D);
+    }
+    ipart = x;
+    ipart.RoundTo(0, ROUND_DOWN);
+
+    // The fraction is just the low digits, no subtraction needed.
+    Decimal frac(x.iterations);
+    frac.type = NumType::_NORMAL;
+    frac.sign = x.sign;
+    frac.decimals = x.decimals;
+    frac.number.assign(x.number.begin(), x.number.begin() + x.decimals);
+    frac.number.push_back('0');
+    frac.TrailTrim();
+    if (frac.number.size() == 1 && frac.number[0] == '0')
+        frac.sign = '+';
+    return frac;
+}
+
 Decimal Decimal::Inc() {
     Decimal x = *this;
     if (x < 0) {
@@ -1358,118 +2084,458 @@ Decimal Decimal::Dec() {
     return x;
 };
 
-Decimal DecimalConstants::ImprovisedSqrt(const Decimal& a) const {
-    Decimal x = 1_D;
-    for (int i = 1; i <= iterations.sqrt; i++) {
-        x = (x + a/x) / 2_D;
+// Extra places carried by the cached constants, so that rounding an
+// entry down to any lower precision is still right to the last place.
+// Requests up to DECIMAL_DIGITS_PLACES less these are served from the
+// tables in DecimalDigits.h.
+static const int CONSTANT_GUARD_DIGITS = 5;
+
+// e = sum 1/n!, with enough terms that 1/N! is below the last place.
+static Decimal SeriesE(const DecimalIterations& work)
+{
+    unsigned long terms = std::max(work.E, 2);
+    double digits = 0;
+    for (unsigned long n = 2; n < terms; n++)
+        digits += std::log10(static_cast<double>(n));
+    while (digits < work.decimals + 2)
+        digits += std::log10(static_cast<double>(terms++));
+    DecimalSeries series([](unsigned long) { return DecimalInt(1); },
+                         [](unsigned long n) { return DecimalInt(n == 0 ? 1 : static_cast<long long>(n)); },
+                         [](unsigned long) { return DecimalInt(1); });
+    return series.Sum(terms, work);
+}
+
+// Chudnovsky: pi = 426880 sqrt(10005) / S with
+// S = sum (-1)^k (6k)! (13591409 + 545140134k) / ((3k)! k!^3 640320^3k).
+// Each term adds about 14.18 digits. Binary splitting reduces the sum to
+// S = T / Q, so pi takes one square root and one division by an integer.
+static Decimal SeriesPi(const DecimalIterations& work)
+{
+    unsigned long terms = std::max(work.Pi, static_cast<int>(work.decimals / 14.18) + 1);
+    DecimalSeries chudnovsky(
+        [](unsigned long k) {
+            long long n = static_cast<long long>(k);
+            return (k == 0) ? DecimalInt(1) : DecimalInt(-(6*n - 5) * (2*n - 1) * (6*n - 1));
+        },
+        [](unsigned long k) {
+            // k^3 * 640320^3 / 24
+            DecimalInt n(static_cast<long long>(k));
+            return (k == 0) ? DecimalInt(1) : n * n * n * DecimalInt(10939058860032000LL);
+        },
+        [](unsigned long k) {
+            return DecimalInt(13591409) + DecimalInt(545140134) * DecimalInt(static_cast<long long>(k));
+        });
+    DecimalSeries::Split s = chudnovsky.Evaluate(0, terms);
+    Decimal root = xFD::Sqrt(10005_D(work));
+    return (root * (DecimalInt(426880) * s.Q).ToDecimal())(work) / s.T.ToDecimal()(work);
+}
+
+// atanh(1/m) = sum 1/((2k+1) m^(2k+1)), about 2 log10(m) digits a term.
+static Decimal AtanhRecip(long long m, const DecimalIterations& work)
+{
+    unsigned long terms = static_cast<unsigned long>(work.decimals / (2 * std::log10(static_cast<double>(m)))) + 2;
+    DecimalSeries series([](unsigned long k) { return DecimalInt(k == 0 ? 1 : 2 * static_cast<long long>(k) - 1); },
+                         [m](unsigned long k) { return DecimalInt(k == 0 ? m : m * m * (2 * static_cast<long long>(k) + 1)); },
+                         [](unsigned long) { return DecimalInt(1); });
+    return series.Sum(terms, work);
+}
+
+// Constants computed past the tables, keyed by constant and precision.
+static std::mutex constants_mutex;
+static std::map<std::pair<int, int>, Decimal> constants_cache;
+
+/**
+ * Constants kept on disk between processes, see DecimalConstants::SetStore.
+ *
+ * The file is in native byte order:
+ *
+ *   StoreHeader, count * StoreEntry, the digits of each entry
+ *
+ * The digits are the entry's value as "3.1415...", without a sign or a
+ * terminator. The header checksum covers the entry index, and each entry
+ * has the checksum of its digits. The file is only ever replaced whole,
+ * by renaming a finished copy over it, so a mapping never sees a partial
+ * write. Anything that doesn't check out is ignored and later replaced.
+ */
+class ConstantStore {
+public:
+    ~ConstantStore() { Unmap(); }
+
+    void SetPath(const std::string& path);
+
+    // Digits of constant c to at least `places` decimals, cut to them.
+    bool Find(int c, int places, std::string& digits);
+
+    // Records x as constant c to `places` decimals, unless the store
+    // already has it as precisely.
+    void Save(int c, int places, const Decimal& x);
+
+private:
+    struct StoreHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t count;
+        uint64_t checksum;
+    };
+    struct StoreEntry {
+        uint32_t constant;
+        uint32_t places;
+        uint64_t offset;
+        uint64_t length;
+        uint64_t checksum;
+    };
+
+    static const uint32_t VERSION = 1;
+
+    std::mutex mutex;
+    std::string path;
+    const char* data = nullptr;
+    size_t size = 0;
+#ifdef DECIMAL_HAVE_MMAP
+    struct stat mapped;
+#endif
+
+    static uint64_t Checksum(const char* p, size_t n);
+    const StoreEntry* Entries() const { return reinterpret_cast<const StoreEntry*>(data + sizeof(StoreHeader)); }
+    size_t Count() const { return data ? reinterpret_cast<const StoreHeader*>(data)->count : 0; }
+
+    // Maps the file again if another process has replaced it.
+    void Refresh();
+    bool Valid() const;
+    void Unmap();
+};
+
+static ConstantStore constants_store;
+
+uint64_t ConstantStore::Checksum(const char* p, size_t n)
+{
+    // FNV-1a
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < n; i++) {
+        h ^= static_cast<unsigned char>(p[i]);
+        h *= 1099511628211ULL;
     }
-    return x;
+    return h;
+}
+
+void ConstantStore::SetPath(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    Unmap();
+    this->path = path;
+}
 
+void ConstantStore::Unmap()
+{
+#ifdef DECIMAL_HAVE_MMAP
+    if (data)
+        munmap(const_cast<char*>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
 }
 
-void DecimalConstants::GenE() {
-    Decimal e = 1_D; // i = 0
-    int i = 1;
-    Decimal fact = 1_D;
-    while (i < iterations.E) {
-        e += 1_D / fact;
-        i += 1;
-        fact *= i;
-    }
-    pE = e;
-}
-
-void DecimalConstants::Gen_1Pi() {
-    Decimal n1 = "13591409"_D;
-    Decimal n2 = "545140134"_D;
-    Decimal d1 = "640320"_D;
-    Decimal sqd1 = ImprovisedSqrt(d1);
-    Decimal _3d1 = d1*d1*d1;
-    auto ipi = n1;
-    int i = 1;
-    Decimal _ifacti = 1_D;
-    Decimal _3ifacti = 6_D;
-    Decimal _6ifacti = 720_D;
-    Decimal sign = -1_D;
-    while (i < iterations.Pi) {
-        Decimal fi3 = _ifacti*_ifacti*_ifacti;
-        Decimal n = sign *_6ifacti * (n1 + n2*i);
-        Decimal d = _3ifacti * fi3 * _3d1 * sqd1 * d1;
-        ipi += n/d;
-        i += 1;
-        sign *= -1_D;
-        _ifacti *= i;
-        // Multiply by (3*i) * (3*(i-1)) * (3*(i-2))
-        _3ifacti *= 27_D*i*(i-1)*(i-2);
-        // Multiply by (6*i) * (6*(i-1)) * (6*(i-2)) * (6*(i-3)) * (6*(i-4)) * (6*(i-5))
-        _6ifacti *= 46656_D*i*(i-1)*(i-2)*(i-3)*(i-4)*(i-5);
+void ConstantStore::Refresh()
+{
+#ifdef DECIMAL_HAVE_MMAP
+    struct stat st;
+    if (path.empty() || stat(path.c_str(), &st) != 0) {
+        Unmap();
+        return;
+    }
+    if (data && st.st_dev == mapped.st_dev && st.st_ino == mapped.st_ino &&
+        st.st_size == mapped.st_size && st.st_mtime == mapped.st_mtime)
+        return;
+    Unmap();
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+    if (fstat(fd, &mapped) == 0 && mapped.st_size > 0) {
+        void* p = mmap(nullptr, mapped.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (p != MAP_FAILED) {
+            data = static_cast<const char*>(p);
+            size = mapped.st_size;
+        }
+    }
+    close(fd);
+    if (data && !Valid())
+        Unmap();
+#endif
+}
+
+bool ConstantStore::Valid() const
+{
+    if (size < sizeof(StoreHeader))
+        return false;
+    const StoreHeader* h = reinterpret_cast<const StoreHeader*>(data);
+    if (std::memcmp(h->magic, "xFDCONST", 8) != 0 || h->version != VERSION)
+        return false;
+    if (h->count > (size - sizeof(StoreHeader)) / sizeof(StoreEntry))
+        return false;
+    if (Checksum(data + sizeof(StoreHeader), h->count * sizeof(StoreEntry)) != h->checksum)
+        return false;
+    for (size_t i = 0; i < h->count; i++) {
+        const StoreEntry& e = Entries()[i];
+        if (e.offset > size || e.length > size - e.offset)
+            return false;
+    }
+    return true;
+}
+
+bool ConstantStore::Find(int c, int places, std::string& digits)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    Refresh();
+    for (size_t i = 0; i < Count(); i++) {
+        const StoreEntry& e = Entries()[i];
+        if (static_cast<int>(e.constant) != c || e.places < static_cast<uint32_t>(places))
+            continue;
+        const char* p = data + e.offset;
+        if (Checksum(p, e.length) != e.checksum)
+            continue;
+        const char* point = static_cast<const char*>(std::memchr(p, '.', e.length));
+        size_t n = point ? std::min<size_t>(e.length, point - p + 1 + places) : e.length;
+        digits.assign(p, n);
+        return true;
+    }
+    return false;
+}
+
+void ConstantStore::Save(int c, int places, const Decimal& x)
+{
+#ifdef DECIMAL_HAVE_MMAP
+    std::lock_guard<std::mutex> lock(mutex);
+    if (path.empty())
+        return;
+    Refresh();
+
+    // Every other sound entry is carried over, and c keeps only the new
+    // value unless a sound entry already has it as precisely. Damaged
+    // entries are dropped here, so that the next Compute replaces them.
+    std::vector<StoreEntry> entries;
+    std::vector<const char*> sources;
+    for (size_t i = 0; i < Count(); i++) {
+        const StoreEntry& e = Entries()[i];
+        if (Checksum(data + e.offset, e.length) != e.checksum)
+            continue;
+        if (static_cast<int>(e.constant) == c) {
+            if (e.places >= static_cast<uint32_t>(places))
+                return;
+            continue;
+        }
+        entries.push_back(e);
+        sources.push_back(data + e.offset);
+    }
+    std::string digits = x.ToFixedString();
+    if (!digits.empty() && digits[0] == '+')
+        digits.erase(0, 1);
+    StoreEntry added = {static_cast<uint32_t>(c), static_cast<uint32_t>(places), 0, digits.size(), Checksum(digits.data(), digits.size())};
+    entries.push_back(added);
+    sources.push_back(digits.data());
+
+    uint64_t offset = sizeof(StoreHeader) + entries.size() * sizeof(StoreEntry);
+    for (auto& e : entries) {
+        e.offset = offset;
+        offset += e.length;
+    }
+    StoreHeader h;
+    std::memcpy(h.magic, "xFDCONST", 8);
+    h.version = VERSION;
+    h.count = static_cast<uint32_t>(entries.size());
+    h.checksum = Checksum(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(StoreEntry));
+
+    std::string tmp = path + ".tmp." + ToString(getpid());
+    int fd = open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return;
+    auto put = [fd](const void* p, size_t n) {
+        const char* q = static_cast<const char*>(p);
+        while (n > 0) {
+            ssize_t w = write(fd, q, n);
+            if (w <= 0)
+                return false;
+            q += w;
+            n -= w;
+        }
+        return true;
+    };
+    bool ok = put(&h, sizeof(h)) && put(entries.data(), entries.size() * sizeof(StoreEntry));
+    for (size_t i = 0; ok && i < entries.size(); i++)
+        ok = put(sources[i], entries[i].length);
+    ok = ok && fsync(fd) == 0;
+    ok = (close(fd) == 0) && ok;
+    if (!ok || rename(tmp.c_str(), path.c_str()) != 0)
+        unlink(tmp.c_str());
+#else
+    (void)c;
+    (void)places;
+    (void)x;
+#endif
+}
+
+void DecimalConstants::SetStore(const std::string& path)
+{
+    constants_store.SetPath(path);
+}
+
+void DecimalConstants::ClearCache()
+{
+    std::lock_guard<std::mutex> lock(constants_mutex);
+    constants_cache.clear();
+}
+
+Decimal DecimalConstants::Get(Constant c, const DecimalIterations& iterations)
+{
+    DecimalIterations work = iterations;
+    work.decimals += CONSTANT_GUARD_DIGITS;
+    Decimal x = Raw(c, work);
+    x.RoundTo(iterations.decimals, Decimal::ROUND_HALF_EVEN);
+    return x(iterations);
+}
+
+Decimal DecimalConstants::Raw(Constant c, const DecimalIterations& work)
+{
+    // The lock only guards the lookup and the insert. Constants built from
+    // other constants come back in here, and two threads that miss at once
+    // both compute the same value, which is harmless.
+    if (work.decimals <= DECIMAL_DIGITS_PLACES) {
+        // The embedded tables are exact prefixes, cut without rounding.
+        const char* digits = DECIMAL_DIGITS[c];
+        size_t point = std::strchr(digits, '.') - digits;
+        return Decimal(std::string(digits, point + 1 + work.decimals).c_str())(work);
+    }
+    Decimal x;
+    {
+        std::lock_guard<std::mutex> lock(constants_mutex);
+        auto it = constants_cache.lower_bound(std::make_pair(static_cast<int>(c), work.decimals));
+        if (it != constants_cache.end() && it->first.first == c)
+            x = it->second;
+    }
+    if (x.IsNaN()) {
+        std::string digits;
+        if (constants_store.Find(c, work.decimals, digits)) {
+            x = Decimal(digits.c_str());
+        }
+        else {
+            x = Compute(c, work);
+            constants_store.Save(c, work.decimals, x);
+        }
+        std::lock_guard<std::mutex> lock(constants_mutex);
+        constants_cache.emplace(std::make_pair(static_cast<int>(c), work.decimals), x);
+    }
+    else if (x.decimals > work.decimals) {
+        // Cut, so that the guard digits are only rounded once, in Get.
+        x.RoundTo(work.decimals, Decimal::ROUND_DOWN);
+    }
+    return x(work);
+}
+
+Decimal DecimalConstants::Compute(Constant c, const DecimalIterations& work)
+{
+    switch (c) {
+    case C_E:
+        return SeriesE(work);
+    case C_PI:
+        return SeriesPi(work);
+    case C_1PI:
+        return 1_D(work) / Raw(C_PI, work);
+    case C_PI2:
+        return Raw(C_PI, work) / 2_D(work);
+    case C_PI4:
+        return Raw(C_PI, work) / 4_D(work);
+    case C_LN2:
+        // The logarithms come from series rather than Ln, which needs Pow
+        // and so these constants in turn. ln 2 = 2 atanh(1/3).
+        return 2_D * AtanhRecip(3, work);
+    case C_LN10:
+        // ln 10 = 3 ln 2 + ln(5/4), with ln(5/4) = 2 atanh(1/9)
+        return 3_D * Raw(C_LN2, work) + 2_D * AtanhRecip(9, work);
+    case C_2PI:
+        return 2_D * Raw(C_1PI, work);
+    case C_2SQRTPI:
+        return 2_D(work) / xFD::Sqrt(Raw(C_PI, work));
+    case C_LOG2E:
+        return 1_D(work) / Raw(C_LN2, work);
+    case C_LOG10E:
+        return 1_D(work) / Raw(C_LN10, work);
+    case C_SQRT2:
+        return xFD::Sqrt(2_D(work));
+    case C_1SQRT2:
+        return Raw(C_SQRT2, work) / 2_D(work);
+    default:
+        Decimal::Signal(Decimal::STATUS_INVALID, true, "Unknown constant");
+        return Decimal::NaN();
     }
-    ipi *= 12_D;
-    p_1Pi = ipi;
 }
 
 Decimal Decimal::nPr(const Decimal& n, const Decimal& k) {
     if (n.IsNaN() || k.IsNaN() || n.IsInf() || k.IsInf()) {
-        if (n.iterations.TOE() || n.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, n.iterations.TOE() || k.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
     if (!n.IsInt() || !k.IsInt()) {
         return Decimal(0);
     }
-    Decimal den = 1_D;
-    Decimal num = 1_D;
-    for (Decimal i = k+1_D; i <= n; i++) {
-        den *= i;
+    // n!/(n-k)! = (n-k+1) * ... * n
+    DecimalInt N(n), K(k);
+    if (K.IsNegative() || K > N) {
+        return Decimal(0);
     }
-    for (Decimal i = n; i > n-k; i--) {
-        num *= i;
+    DecimalInt i = N - K;
+    DecimalInt r(1);
+    while (i < N) {
+        i.MulAdd(1, 1);
+        r *= i;
     }
-    return num/den;
+    Decimal res = std::move(r).ToDecimal();
+    res.iterations = n.iterations;
+    return res;
 }
 
 Decimal Decimal::nCr(const Decimal& n, const Decimal& k) {
     if (n.IsNaN() || k.IsNaN() || n.IsInf() || k.IsInf()) {
-        if (n.iterations.TOE() || k.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, n.iterations.TOE() || k.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
     if (!n.IsInt() || !k.IsInt()) {
         return Decimal(0);
     }
-    Decimal den1 = 1_D;
-    Decimal den2 = 1_D;
-    Decimal num = 1_D;
-    for (Decimal i = 0_D; i <= k; i++) {
-        den1 *= i;
-    }
-    for (Decimal i = k+1_D; i <= n; i++) {
-        den2 *= i;
-    }
-    for (Decimal i = n; i > n-k; i--) {
-        num *= i;
+    DecimalInt N(n), K(k);
+    if (K.IsNegative() || K > N) {
+        return Decimal(0);
     }
-    return num/(den1*den2);
+    if (N - K < K) {
+        K = N - K;
+    }
+    // After step i, r = nCr(n-k+i, i), so every division is exact.
+    unsigned long steps = K.ToDecimal().ToULong64();
+    DecimalInt top = N - K;
+    DecimalInt r(1);
+    for (unsigned long i = 1; i <= steps; i++) {
+        top.MulAdd(1, 1);
+        r *= top;
+        r.DivSmall(i);
+    }
+    Decimal res = std::move(r).ToDecimal();
+    res.iterations = n.iterations;
+    return res;
 }
 
 Decimal Decimal::Binomial(const Decimal& x, const Decimal& y, const Decimal& n) {
     if (x.IsNaN() || y.IsNaN() || n.IsNaN() || x.IsInf() || y.IsInf() || n.IsInf()) {
         //FIXME too, for sinh - this is too long and unwieldly!
-        if (x.iterations.TOE() || y.iterations.TOE() || n.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE() || y.iterations.TOE() || n.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
     if (!n.IsInt()) {
-        throw DecimalIllegalOperation("Binomial power must be an integer");
+        Signal(STATUS_INVALID, n.iterations.TOE(), "Binomial power must be an integer");
+        return NaN();
     }
     Decimal s = 0_D;
     Decimal py = 1_D;
-    Decimal px = 2_D;
-    for (Decimal i = 0_D; i < n; i++) {
-        px *= x;
-    }
+    Decimal px = xFD::IPow(x, n);
     for (Decimal k = 0_D; k < n+1; k++) {
-        s += Decimal::nCr(n, k)*py*px;
+        s = xFD::Fma(Decimal::nCr(n, k)*py, px, s);
         py *= y;
         px /= x;
     }
@@ -1477,209 +2543,566 @@ Decimal Decimal::Binomial(const Decimal& x, const Decimal& y, const Decimal& n)
 }
 
 Decimal SeqBernoulli::pTerm(const Decimal& n) const {
-    if (n == 0_D) {
+    if (n.IsZero()) {
         return 1_D;
     }
-    else if (n == 1_D) {
+    else if (n.IsOne()) {
         return -0.5_D;
     }
-    else if (n % 2_D == 1_D) {
+    else if ((n % 2_D).IsOne()) {
         return 0_D;
     }
-    // N is even >= 2
-    auto PI = xFDCon::Pi();
-    Decimal _2ni = 1_D; 
-    Decimal _2n = 2_D; 
-    Decimal _nfacti = 1_D; 
-    Decimal _pini = 1_D; 
-    Decimal _pin = PI; 
-    for (Decimal i = 1_D; i < n+1; i++) {
-        _2ni *= _2n;
-        _pini *= _pin;
-        _nfacti *= i;
-    }
-    auto phic = 2_D * (_2ni-1)*_nfacti / (_2ni/2_D  * _pini);
-    Decimal s = 0_D;
-    for (Decimal k = 1_D; k < xFD::Ceil(1.5_D*n); k++) {
-        Decimal _kni = 1_D;
-        for (Decimal kk = 0_D; kk < n; kk++) {
-            _kni *= k;
-        }
-        _kni = 1_D/_kni;
-        s += _kni;
-    }
-    auto phi = xFD::Floor(phic * s);
-    auto term = (1_D+phi)/2_D*(_2ni-1_D);
-    if (n % 4_D == 0_D) {
-        term = -term;
-    }
-     return term;
+    // N = 2m is even >= 2, and B_2m = (-1)^(m-1) 2m T_m / (4^m (4^m - 1))
+    // where T_m is the tangent number tan^(2m-1)(0). The tangent numbers
+    // are integers and come from the recurrence of Brent and Zimmermann,
+    // so the only rounding is in the final division.
+    unsigned long m = n.ToULong64() / 2;
+    std::vector<DecimalInt> T(m + 1);
+    T[1] = DecimalInt(1);
+    for (unsigned long k = 2; k <= m; k++) {
+        T[k] = T[k-1];
+        T[k].MulAdd(k - 1, 0);
+    }
+    for (unsigned long k = 2; k <= m; k++) {
+        for (unsigned long j = k; j <= m; j++) {
+            DecimalInt a = T[j-1];
+            a.MulAdd(j - k, 0);
+            T[j].MulAdd(j - k + 2, 0);
+            T[j] += a;
+        }
+    }
+    DecimalInt num = T[m];
+    num.MulAdd(2 * m, 0);
+    DecimalInt den(1);
+    for (unsigned long k = 0; k < m; k++)
+        den.MulAdd(4, 0);
+    den = den * (den - DecimalInt(1));
+    Decimal term = num.ToDecimal() / den.ToDecimal();
+    return (m % 2 == 0) ? -term : term;
 }
 
 Decimal Decimal::Sinh(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
     return (xFD::Pow(x) - xFD::Pow(-x)) / 2_D;
 }
 
 Decimal Decimal::Cosh(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
     return (xFD::Pow(x) + xFD::Pow(-x)) / 2_D;
 }
 
-// Required to compute e^x
 Decimal Decimal::Tanh(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
-    }
-    if (x.IsInf() || x.IsNaN()) return NaN();
-    Decimal i = 1_D;
-    Decimal T = 0_D;
-    Decimal _22n = 4_D;
-    Decimal _22ni = _22n;
-    Decimal _x2nm1 = x;
-    Decimal _x2nm12 = x*x;
-    Decimal _x2nm1i = _x2nm1;
-    Decimal fact = 2_D;
-    while (i < x.iterations.tanh) {
-        Decimal n = _22ni * (_22ni-1_D) * SeqBernoulli::Term(2_D*i) * _x2nm1i;
-        T += n/fact;
-        _22ni *= _x2nm12;
-        _x2nm1i *= _x2nm12;
-        i += 1_D;
-        fact *= i*2_D;
-        fact *= i*2_D - 1_D;
-    }
-    return T;
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    // tanh x = (e^2x - 1) / (e^2x + 1), worked with guard digits.
+    DecimalIterations work = x.iterations;
+    work.decimals += 5;
+    Decimal e2x = xFD::Pow((2_D * x)(work));
+    Decimal t = (e2x - 1_D) / (e2x + 1_D)(work);
+    t.RoundTo(x.iterations.decimals, x.iterations.trunc_not_round ? ROUND_DOWN : ROUND_HALF_UP);
+    t.TrailTrim();
+    t.iterations = x.iterations;
+    return t;
 }
 
 Decimal Decimal::Coth(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
-    if (x == 0_D) {
-        if (x.iterations.throw_on_error) {
-            throw DecimalIllegalOperation("Hyperbolic Cot is undefined at x = 0");
-        }
-        else {
-            return NaN(); // It's 0/0
-        }
+    if (x.IsZero()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "Hyperbolic Cot is undefined at x = 0");
+        return NaN(); // It's 0/0
     }
     return 1_D/xFD::Tanh(x);
 }
 
-Decimal Decimal::Sech(const Decimal& x) {
-    if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
-    }
-    return 1_D/xFD::Cosh(x);
+Decimal Decimal::Sech(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    return 1_D/xFD::Cosh(x);
+}
+
+Decimal Decimal::Csch(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    return 1_D/xFD::Sinh(x);
+}
+
+// And we get the inverse hyperbolic functions for free,
+// courtesy of logarithms and sqrts.
+
+Decimal Decimal::Asinh(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    return xFD::Ln(x + xFD::Sqrt(x*x + 1));
+}
+
+Decimal Decimal::Acosh(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    return xFD::Ln(x + xFD::Sqrt(x*x - 1));
+}
+
+Decimal Decimal::Atanh(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    return xFD::Ln((1_D+x)/(1_D-x))/2_D;
+}
+
+Decimal Decimal::Acoth(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    return xFD::Ln((x+1_D)/(x-1_D))/2_D;
+}
+
+Decimal Decimal::Asech(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    return xFD::Ln((1_D/x) + xFD::Sqrt(1_D/x*x - 1_D));
+}
+
+Decimal Decimal::Acsch(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    return xFD::Ln((1_D/x) + xFD::Sqrt(1_D/x*x + 1_D));
+}
+
+
+Decimal Decimal::Erf(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    Decimal hw;
+    if (HardwareEval(erfl, x, hw)) {
+        return hw;
+    }
+    int places = x.iterations.decimals;
+    Decimal term = x;
+    Decimal n = 1_D;
+    Decimal _2n = 2_D;
+    Decimal fact = 1_D;
+    Decimal _x2 = Decimal::MulFixed(x, x, places);
+    Decimal _xp = Decimal::MulFixed(_x2, x, places);
+    Decimal sign = -1_D;
+
+    for (int i = 1; i <= x.iterations.trig; i++) {
+        term += sign * _xp / (fact*(_2n+1_D));
+        _xp = Decimal::MulFixed(_xp, _x2, places);
+        n += 1_D;
+        fact *= n;
+        _2n += 2_D;
+        sign *= -1_D;
+    }
+    return term*xFDCon::_2SqrtPi(x.iterations);
+}
+
+//Hardware tier: a long double carries 64 bits of mantissa, a little over
+//19 digits, so up to 15 decimals can be produced with room for an error
+//bound. The result is only accepted when that bound keeps it clear of the
+//rounding boundary.
+static const int HARDWARE_MAX_DECIMALS = 15;
+
+bool Decimal::HardwareArg(const Decimal& x, long double& xl)
+{
+    if (x.type != NumType::_NORMAL || x.iterations.decimals > std::min(Tuning().hardware, HARDWARE_MAX_DECIMALS))
+        return false;
+    xl = strtold(x.ToFixedString().c_str(), nullptr);
+    return std::isfinite(xl);
+}
+
+bool Decimal::HardwareRound(long double y, long double err, const DecimalIterations& its, Decimal& result)
+{
+    if (!std::isfinite(y) || !std::isfinite(err))
+        return false;
+    int p = its.decimals;
+    long double scale = 1;
+    for (int i = 0; i < p; i++)
+        scale *= 10;
+    long double s = fabsl(y) * scale;
+    if (s >= 1e18L)
+        return false;
+    long double e = err * scale + 2 * LDBL_EPSILON * s;
+
+    long double fl = floorl(s);
+    long double frac = s - fl;
+    bool down = its.trunc_not_round;
+    long double margin = down ? std::min(frac, 1 - frac) : fabsl(frac - 0.5L);
+    if (margin <= e)
+        return false;
+    // Within the error of a grid point the value may well be exact.
+    if (std::min(frac, 1 - frac) > e)
+        status_flags |= STATUS_INEXACT;
+
+    // Below 10^18 the integer conversion is exact.
+    unsigned long long n = static_cast<unsigned long long>(fl);
+    if (!down && frac > 0.5L)
+        n++;
+    Decimal tmp(its);
+    tmp.type = NumType::_NORMAL;
+    tmp.sign = (y < 0) ? '-' : '+';
+    tmp.decimals = p;
+    do {
+        tmp.number.push_back(IntToChar(n % 10));
+        n /= 10;
+    } while (n != 0);
+    if (tmp.number.size() < static_cast<size_t>(p) + 1)
+        tmp.number.insert(tmp.number.end(), p + 1 - tmp.number.size(), '0');
+    tmp.TrailTrim();
+    if (tmp.number.size() == 1 && tmp.number[0] == '0')
+        tmp.sign = '+';
+    result = tmp;
+    return true;
+}
+
+bool Decimal::HardwareEval(long double (*f)(long double), const Decimal& x, Decimal& result)
+{
+    long double xl;
+    if (!HardwareArg(x, xl))
+        return false;
+    // The spread over the neighbouring arguments bounds the effect of x
+    // having been rounded to binary, a few ulps more cover the library.
+    long double y = f(xl);
+    long double spread = fabsl(f(nextafterl(xl, INFINITY)) - f(nextafterl(xl, -INFINITY)));
+    return HardwareRound(y, spread + 4 * LDBL_EPSILON * fabsl(y) + LDBL_MIN, x.iterations, result);
+}
+
+bool Decimal::HardwareEval(long double (*f)(long double, long double), const Decimal& x, const Decimal& y, Decimal& result)
+{
+    long double xl, yl;
+    if (!HardwareArg(x, xl) || !HardwareArg(y, yl))
+        return false;
+    long double z = f(xl, yl);
+    long double spread = fabsl(f(nextafterl(xl, INFINITY), yl) - f(nextafterl(xl, -INFINITY), yl)) +
+                         fabsl(f(xl, nextafterl(yl, INFINITY)) - f(xl, nextafterl(yl, -INFINITY)));
+    DecimalIterations its = x.iterations;
+    its.decimals = std::max(x.iterations.decimals, y.iterations.decimals);
+    return HardwareRound(z, spread + 4 * LDBL_EPSILON * fabsl(z) + LDBL_MIN, its, result);
+}
+
+// atan2 on the same branches as Atan2: cos = x, sin = y, and the third
+// quadrant moved up by a full turn.
+static long double HardwareAtan2(long double x, long double y)
+{
+    long double r = atan2l(y, x);
+    if (x < 0 && y < 0)
+        r += 8 * atanl(1.0L);
+    return r;
+}
+
+//Double-double tier: an unevaluated sum hi + lo of two doubles carries
+//106 bits, close to 32 digits, with error-free transformations built on
+//fma. It serves the precisions between the hardware tier and the point
+//where the Decimal series pay off, under the same rounding-boundary
+//check as the hardware tier.
+static const int DD_MAX_DECIMALS = 30;
+static const double DD_EPS = 4.93038065763132e-32;    // 2^-104
+
+struct DD {
+    double hi, lo;
+    DD(double h = 0, double l = 0) : hi(h), lo(l) {}
+};
+
+static inline DD QuickTwoSum(double a, double b)
+{
+    double s = a + b;
+    return DD(s, b - (s - a));
+}
+
+static inline DD TwoSum(double a, double b)
+{
+    double s = a + b;
+    double bb = s - a;
+    return DD(s, (a - (s - bb)) + (b - bb));
+}
+
+static inline DD TwoProd(double a, double b)
+{
+    double p = a * b;
+    return DD(p, std::fma(a, b, -p));
+}
+
+static inline DD operator+(const DD& a, const DD& b)
+{
+    DD s = TwoSum(a.hi, b.hi);
+    DD t = TwoSum(a.lo, b.lo);
+    s.lo += t.hi;
+    s = QuickTwoSum(s.hi, s.lo);
+    s.lo += t.lo;
+    return QuickTwoSum(s.hi, s.lo);
+}
+
+static inline DD operator-(const DD& a)
+{
+    return DD(-a.hi, -a.lo);
+}
+
+static inline DD operator-(const DD& a, const DD& b)
+{
+    return a + (-b);
+}
+
+static inline DD operator*(const DD& a, const DD& b)
+{
+    DD p = TwoProd(a.hi, b.hi);
+    p.lo += a.hi * b.lo + a.lo * b.hi;
+    return QuickTwoSum(p.hi, p.lo);
+}
+
+static inline DD operator/(const DD& a, const DD& b)
+{
+    double q1 = a.hi / b.hi;
+    DD r = a - b * DD(q1);
+    double q2 = r.hi / b.hi;
+    r = r - b * DD(q2);
+    double q3 = r.hi / b.hi;
+    return QuickTwoSum(q1, q2) + DD(q3);
+}
+
+static inline DD DDLdexp(const DD& a, int k)
+{
+    return DD(std::ldexp(a.hi, k), std::ldexp(a.lo, k));
 }
 
-Decimal Decimal::Csch(const Decimal& x) {
-    if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
-    }
-    return 1_D/xFD::Sinh(x);
+static inline DD DDFloor(const DD& a)
+{
+    double hi = std::floor(a.hi);
+    return (hi == a.hi) ? QuickTwoSum(hi, std::floor(a.lo)) : DD(hi);
 }
 
-// And we get the inverse hyperbolic functions for free,
-// courtesy of logarithms and sqrts.
+static const DD DD_LN2(6.931471805599452862e-01, 2.319046813846299558e-17);
+static const DD DD_PI2(1.570796326794896558e+00, 6.123233995736766036e-17);
 
-Decimal Decimal::Asinh(const Decimal& x) {
-    if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
-    }
-    return xFD::Ln(x + xFD::Sqrt(x*x + 1));
+// Each function returns its value and an absolute error bound, or false
+// when the argument is out of its range.
+typedef bool (*DDFunc)(const DD& x, DD& y, double& err);
+
+static bool DDExp(const DD& x, DD& y, double& err)
+{
+    if (std::fabs(x.hi) > 700)
+        return false;
+    // x = k*ln2 + r, then e^r = (e^(r/32))^32 with a short Taylor series
+    // for e^(r/32) - 1 so that the squarings don't lose the small part.
+    double k = std::floor(x.hi / DD_LN2.hi + 0.5);
+    DD r = DDLdexp(x - DD_LN2 * DD(k), -5);
+    DD s = r, term = r;
+    for (int n = 2; n <= 14; n++) {
+        term = term * r / DD(n);
+        s = s + term;
+    }
+    for (int i = 0; i < 5; i++)
+        s = DDLdexp(s, 1) + s * s;
+    y = DDLdexp(s + DD(1), static_cast<int>(k));
+    err = std::fabs(y.hi) * (std::fabs(x.hi) + 64) * DD_EPS;
+    return true;
 }
 
-Decimal Decimal::Acosh(const Decimal& x) {
-    if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
-    }
-    return xFD::Ln(x + xFD::Sqrt(x*x - 1));
+static bool DDLog(const DD& x, DD& y, double& err)
+{
+    if (!(x.hi > 0))
+        return false;
+    // Newton on e^y = x, each step doubles the correct digits.
+    y = DD(std::log(x.hi));
+    for (int i = 0; i < 2; i++) {
+        DD e;
+        double e_err;
+        DDExp(-y, e, e_err);
+        y = y + x * e - DD(1);
+    }
+    err = (std::fabs(y.hi) + 64) * DD_EPS;
+    return true;
 }
 
-Decimal Decimal::Atanh(const Decimal& x) {
-    if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+// sin and cos of |r| <= pi/4.
+static DD DDSinKernel(const DD& r)
+{
+    DD r2 = r * r, s = r, term = r;
+    for (int n = 1; n <= 14; n++) {
+        term = -term * r2 / DD((2*n) * (2*n + 1));
+        s = s + term;
     }
-    return xFD::Ln((1_D+x)/(1_D-x))/2_D;
+    return s;
 }
 
-Decimal Decimal::Acoth(const Decimal& x) {
-    if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+static DD DDCosKernel(const DD& r)
+{
+    DD r2 = r * r, s(1), term(1);
+    for (int n = 1; n <= 14; n++) {
+        term = -term * r2 / DD((2*n - 1) * (2*n));
+        s = s + term;
     }
-    return xFD::Ln((x+1_D)/(x-1_D))/2_D;
+    return s;
 }
 
-Decimal Decimal::Asech(const Decimal& x) {
-    if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
-    }
-    return xFD::Ln((1_D/x) + xFD::Sqrt(1_D/x*x - 1_D));
+static bool DDSinCos(const DD& x, DD& y, double& err, bool cosine)
+{
+    if (std::fabs(x.hi) > 1e6)
+        return false;
+    double k = std::floor(x.hi / DD_PI2.hi + 0.5);
+    DD r = x - DD_PI2 * DD(k);
+    int q = static_cast<int>(std::fmod(k, 4.0));
+    if (q < 0)
+        q += 4;
+    if (cosine)
+        q = (q + 1) % 4;
+    switch (q) {
+    case 0: y = DDSinKernel(r); break;
+    case 1: y = DDCosKernel(r); break;
+    case 2: y = -DDSinKernel(r); break;
+    default: y = -DDCosKernel(r); break;
+    }
+    err = (std::fabs(k) * 4 + 64) * DD_EPS;
+    return true;
 }
 
-Decimal Decimal::Acsch(const Decimal& x) {
-    if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
-    }
-    return xFD::Ln((1_D/x) + xFD::Sqrt(1_D/x*x + 1_D));
+static bool DDSin(const DD& x, DD& y, double& err)
+{
+    return DDSinCos(x, y, err, false);
 }
 
+static bool DDCos(const DD& x, DD& y, double& err)
+{
+    return DDSinCos(x, y, err, true);
+}
 
-Decimal Decimal::Erf(const Decimal& x) {
-    if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
-    }
-    Decimal term = x;
-    Decimal n = 1_D;
-    Decimal _2n = 2_D;
-    Decimal fact = 1_D;
-    Decimal _x2 = x*x;
-    Decimal _xp = _x2*x;
-    Decimal _22ni = 4_D;
-    Decimal _22n = 4_D;
-    Decimal sign = -1_D;
+static bool DDParse(const Decimal& x, DD& out)
+{
+    if (x.IsNaN() || x.IsInf() || x.Ints() > 300)
+        return false;
+    std::string str = x.ToFixedString();
+    DD v;
+    for (size_t i = 1; i < str.size(); ) {
+        double chunk = 0, scale = 1;
+        for (int k = 0; k < 15 && i < str.size(); i++) {
+            if (str[i] == '.')
+                continue;
+            chunk = chunk * 10 + (str[i] - '0');
+            scale *= 10;
+            k++;
+        }
+        v = v * DD(scale) + DD(chunk);
+    }
+    DD ten(10);
+    DD pow10(1);
+    for (int k = 0; k < x.Decimals(); k++)
+        pow10 = pow10 * ten;
+    out = v / pow10;
+    if (str[0] == '-')
+        out = -out;
+    return std::isfinite(out.hi);
+}
 
-    for (int i = 1; i <= x.iterations.trig; i++) {
-        term += sign/(fact*_22ni) * _xp/(_2n+1_D);
-        _xp *= _x2;
-        fact *= n+1_D;
-        n += 1_D;
-        _2n += 2_D;
-        _22ni *= _22n;
-    }
-    return term*xFDCon::_2SqrtPi();
+// Exact value of an integer valued double: beyond 2^53 it is m * 2^e.
+static Decimal DDInt(double v)
+{
+    int e;
+    double m = std::frexp(std::fabs(v), &e);
+    e -= 53;
+    Decimal r;
+    if (e > 0)
+        r = Decimal(static_cast<unsigned long long>(std::ldexp(m, 53))) * xFD::IPow(2_D, Decimal(e));
+    else
+        r = Decimal(static_cast<unsigned long long>(std::fabs(v)));
+    return (v < 0) ? -r : r;
+}
+
+static bool DDRound(const DD& y, double err, const DecimalIterations& its, Decimal& result)
+{
+    if (!std::isfinite(y.hi) || !std::isfinite(err))
+        return false;
+    int p = its.decimals;
+    DD scale(1);
+    for (int i = 0; i < p; i++)
+        scale = scale * DD(10);
+    DD s = (y.hi < 0) ? -y * scale : y * scale;
+    if (s.hi >= 1e30)
+        return false;
+    double e = err * scale.hi + DD_EPS * s.hi;
+
+    DD fl = DDFloor(s);
+    double frac = (s - fl).hi;
+    bool down = its.trunc_not_round;
+    double margin = down ? std::min(frac, 1 - frac) : std::fabs(frac - 0.5);
+    if (margin <= e)
+        return false;
+    if (std::min(frac, 1 - frac) > e)
+        status_flags |= Decimal::STATUS_INEXACT;
+
+    Decimal n = DDInt(fl.hi) + DDInt(fl.lo);
+    if (!down && frac > 0.5)
+        n = n + 1_D;
+
+    std::string digits = n.ToFixedString().substr(1);
+    if (digits.size() < static_cast<size_t>(p) + 1)
+        digits.insert(0, p + 1 - digits.size(), '0');
+    if (p > 0)
+        digits.insert(digits.size() - p, ".");
+    if (y.hi < 0)
+        digits.insert(0, "-");
+    result = Decimal(digits)(its);
+    result.TrailTrim();
+    if (result.IsZero())
+        result = 0_D(its);
+    return true;
+}
+
+static bool DDEval(DDFunc f, const Decimal& x, Decimal& result)
+{
+    if (x.GetIterations().decimals > std::min(xFD::Tuning().double_double, DD_MAX_DECIMALS))
+        return false;
+    DD xd, y, lo, hi;
+    double err, e1, e2;
+    if (!DDParse(x, xd) || !f(xd, y, err))
+        return false;
+    // Widen the bound by the spread over the conversion error of x.
+    double d = std::fabs(xd.hi) * 4 * DD_EPS;
+    if (!f(xd - DD(d), lo, e1) || !f(xd + DD(d), hi, e2))
+        return false;
+    return DDRound(y, err + std::fabs((hi - lo).hi), x.GetIterations(), result);
+}
+
+static bool DDPow(const Decimal& x, const Decimal& y, Decimal& result)
+{
+    DecimalIterations its = x.GetIterations();
+    its.decimals = std::max(its.decimals, y.GetIterations().decimals);
+    if (its.decimals > std::min(xFD::Tuning().double_double, DD_MAX_DECIMALS))
+        return false;
+    DD xd, yd, l, z;
+    double err, e;
+    if (!DDParse(x, xd) || !DDParse(y, yd) || !DDLog(xd, l, e))
+        return false;
+    DD t = yd * l;
+    if (!DDExp(t, z, err))
+        return false;
+    // The error of the logarithm is amplified by y and by the result.
+    err += std::fabs(z.hi) * (std::fabs(t.hi) + 64) * DD_EPS * 4 +
+           std::fabs(z.hi) * std::fabs(yd.hi) * e;
+    return DDRound(z, err, its, result);
 }
 
 //Gamma, beta, and bessel will have to wait for another day.
@@ -1687,152 +3110,343 @@ Decimal Decimal::Erf(const Decimal& x) {
 // Computes e^x.
 Decimal Decimal::Pow(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
-    }
-    Decimal xi = xFD::Floor(x);
-    Decimal xf = x - xi;
-    Decimal txf_2 = xFD::Tanh(xf/2_D);
-    Decimal exf = 1_D + 2_D*txf_2 / (1_D-txf_2);
-    Decimal exi;
-    if (xi == 0_D) {
-        return exf;
-    }
-    auto E = xFDCon::E();
-    // Make a 2's compliment bitset starting at the highest bit.
-    bool take_reciprocal = false;
-    if (x < 0) {
-        take_reciprocal = true;
-    }
-    Decimal i = 1_D;
-    Decimal j = 1_D;
-    while (i < x) {
-        i *= 2;
-        j += 1;
-    }
-    if (i == x) {
-        // Optimization when the power is a single 2's bit. 
-        exi = E;
-        for (Decimal jj = 1_D; jj < j; jj++) {
-            exi *= exi;
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    Decimal hw;
+    if (HardwareEval(expl, x, hw) || DDEval(DDExp, x, hw)) {
+        return hw;
+    }
+    Decimal xi;
+    Decimal xf = xFD::Modf(x, xi);
+
+    // e^frac from its Taylor series on frac / 2^10, whose terms fall off by
+    // three digits each, then squared back ten times. The guard digits
+    // cover the squarings and the truncated products.
+    DecimalIterations work = x.iterations;
+    work.decimals += 10;
+    int places = work.decimals;
+    Decimal r = MulFixed(xf(work), 0.0009765625_D, places);
+    Decimal term = 1_D(work), exf = 1_D(work);
+    for (unsigned long n = 1; !term.IsZero(); n++) {
+        term = MulFixed(term, r, places) / Decimal(n)(work);
+        exf += term;
+    }
+    for (int i = 0; i < 10; i++)
+        exf = MulFixed(exf, exf, places);
+
+    // e^int is an exact integer power of the constant, a negative
+    // exponent takes a single reciprocal.
+    // a^(int+frac) = a^int * a^frac
+    Decimal res = xi.IsZero() ? exf : xFD::IPow(xFDCon::E(work), xi) * exf;
+    res.RoundTo(x.iterations.decimals, x.iterations.trunc_not_round ? ROUND_DOWN : ROUND_HALF_UP);
+    res.TrailTrim();
+    res.iterations = x.iterations;
+    return res;
+}
+
+Decimal Decimal::Pow(const Decimal& x, const Decimal& y) {
+    if (x.IsNaN() || x.IsInf() || y.IsNaN() || y.IsInf()) {
+        Signal(STATUS_INVALID, x.iterations.TOE() || y.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    // Integral exponents are exact and need no logarithm at all.
+    if (y.IsInt() && !y.IsInf() && !y.IsNaN()) {
+        return IPow(x, y);
+    }
+    Decimal hw;
+    if (HardwareEval(powl, x, y, hw) || DDPow(x, y, hw)) {
+        return hw;
+    }
+    // The exponent carries guard digits into e^(y ln x), which is then
+    // rounded once.
+    DecimalIterations its = x.iterations;
+    its.decimals = std::max(x.iterations.decimals, y.iterations.decimals);
+    DecimalIterations work = its;
+    work.decimals += 5;
+    Decimal res = Pow((y * Ln(x(work)))(work));
+    res.RoundTo(its.decimals, its.trunc_not_round ? ROUND_DOWN : ROUND_HALF_UP);
+    res.TrailTrim();
+    res.iterations = its;
+    return res;
+}
+
+Decimal Decimal::PowWindow(const Decimal& base, const Decimal& n, const DecimalModulus* mod)
+{
+    auto reduce = [mod](const Decimal& v) { return mod ? mod->Reduce(v) : v; };
+    if (n.IsZero()) {
+        return reduce(1_D(base.iterations));
+    }
+
+    // Exponent bits, most significant first.
+    std::string hex = n.ToHex();
+    std::string bits;
+    for (char h : hex) {
+        int v = (h <= '9') ? h - '0' : h - 'A' + 10;
+        for (int b = 3; b >= 0; b--)
+            bits += ((v >> b) & 1) ? '1' : '0';
+    }
+    bits.erase(0, bits.find('1'));
+
+    size_t nbits = bits.size();
+    int w = (nbits > 671) ? 6 : (nbits > 239) ? 5 : (nbits > 79) ? 4 : (nbits > 23) ? 3 : (nbits > 6) ? 2 : 1;
+
+    // Odd powers base^1, base^3, ..., base^(2^w - 1).
+    std::vector<Decimal> odd(1 << (w - 1));
+    odd[0] = reduce(base);
+    if (w > 1) {
+        Decimal b2 = reduce(Decimal::Sqr(odd[0]));
+        for (size_t i = 1; i < odd.size(); i++)
+            odd[i] = reduce(odd[i-1] * b2);
+    }
+
+    Decimal r;
+    bool first = true;
+    size_t i = 0;
+    while (i < nbits) {
+        if (bits[i] == '0') {
+            r = reduce(Decimal::Sqr(r));
+            i++;
+            continue;
         }
-    }
-    else {
-        // i Greater than x
-        std::vector<Decimal> bit_set;
-        Decimal max_bit = j-1_D;
-        Decimal xmod = x;
-        // Decompose the integral exponent into
-        // two's compliment values and record the indices
-        // i.e. 19 becomes 2^4 + 2^2 + 2^1
-        while (xmod != 0_D) {
-            xmod %= i;
-            i /= 2;
-            j-= 1;
-            if (xmod - (xmod % i) != 0_D) {
-                bit_set.push_back(j);
-            }
+        // Longest window starting here that ends on a set bit.
+        size_t j = std::min(i + w, nbits);
+        while (bits[j-1] == '0')
+            j--;
+        int v = 0;
+        for (size_t k = i; k < j; k++)
+            v = 2*v + (bits[k] - '0');
+        if (first) {
+            r = odd[v >> 1];
+            first = false;
         }
-        exi = 1_D;
-        // Start at E^(2^0) = E^1
-        Decimal extmp = E;
-        // Evaluate the exponent of the two's compliment
-        // representation to get the answer - faster performance
-        // e.g. instead of e^19 evaluate e^(2^4 + 2^2 + 2^1)
-        // = e^(2^4) * e^(2^2) * e^(2^1)
-        for (Decimal k = 1_D; k <= max_bit; k++) {
-            if (std::count(bit_set.begin(), bit_set.end(), k) > 0) {
-                // Perform the exponent multiplication depicted above.
-                exi *= extmp;
-            }
-            // "Increments" to (evaluates) e^(2^1), e^(2^2), ...
-            extmp *= extmp;
+        else {
+            for (size_t k = i; k < j; k++)
+                r = reduce(Decimal::Sqr(r));
+            r = reduce(r * odd[v >> 1]);
         }
+        i = j;
     }
+    return r;
+}
 
-    if (take_reciprocal) {
-        exi = 1_D/exi;
+Decimal Decimal::IPow(const Decimal& base, const Decimal& n) {
+    if (base.IsNaN() || base.IsInf() || n.IsNaN() || n.IsInf()) {
+        Signal(STATUS_INVALID, base.iterations.TOE() || n.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
-
-    // a^(int+frac) = a^int * a^frac
-    return exi * exf;
+    if (!n.IsInt()) {
+        Signal(STATUS_INVALID, n.iterations.TOE(), "Integer power must have an integer exponent");
+        return NaN();
+    }
+    if (n.sign == '-') {
+        return 1_D(base.iterations) / PowWindow(base, -n, nullptr);
+    }
+    return PowWindow(base, n, nullptr);
 }
 
-Decimal Decimal::Pow(const Decimal& x, const Decimal& y) {
-    if (x.IsNaN() || x.IsInf() || y.IsNaN() || y.IsInf()) {
-        if (x.iterations.TOE() || y.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+Decimal Decimal::PowMod(const Decimal& base, const Decimal& e, const Decimal& m) {
+    if (base.IsNaN() || base.IsInf() || e.IsNaN() || e.IsInf() || m.IsNaN() || m.IsInf()) {
+        Signal(STATUS_INVALID, base.iterations.TOE() || e.iterations.TOE() || m.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
-    return Pow(x*Ln(y));
+    if (!e.IsInt() || e.sign == '-') {
+        Signal(STATUS_INVALID, e.iterations.TOE(), "Modular power must have a non-negative integer exponent");
+        return NaN();
+    }
+    DecimalModulus mod(m);
+    return PowWindow(base, e, &mod);
 }
 
 
 //TODO there's an Ln approximation - use that instead?
 Decimal Decimal::Ln(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
-    if (x < 0_D) {
-        throw DecimalIllegalOperation("Ln is undefined for negative numbers");
+    if (x.IsNegative()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "Ln is undefined for negative numbers");
+        return NaN();
     }
-    Decimal L = 1_D;
-    for (Decimal i = 1_D; i < x.iterations.ln; i++) {
-        Decimal eL = xFD::Pow(L);
-        L += 2_D * (x - eL) / (x + eL);
+    if (x.IsZero()) {
+        Signal(STATUS_DIVISION_BY_ZERO, x.iterations.TOE(), "Ln of zero is negative infinity");
+        Decimal tmp = Inf();
+        tmp.sign = '-';
+        return tmp;
     }
+    Decimal hw;
+    if (HardwareEval(logl, x, hw) || DDEval(DDLog, x, hw)) {
+        return hw;
+    }
+    // Halley's method triples the correct digits every step, starting from
+    // the 15 or so that the leading digits give. The steps run with guard
+    // digits and the result is rounded once.
+    DecimalIterations work = x.iterations;
+    work.decimals += 5;
+    Decimal X = x(work);
+    double m;
+    int e;
+    Decimal L = 1_D(work);
+    int steps = x.iterations.ln;
+    if (x.LeadApprox(m, e)) {
+        L = FromApprox(std::log(m) + e * std::log(10.0), 0, work);
+        steps = 1;
+        for (int digits = 14; digits < work.decimals + 2; digits *= 3)
+            steps++;
+        steps = std::min(steps, x.iterations.ln);
+    }
+    for (int i = 0; i < steps; i++) {
+        Decimal eL = xFD::Pow(L(work));
+        L += 2_D * (X - eL) / (X + eL)(work);
+    }
+    L.RoundTo(x.iterations.decimals, x.iterations.trunc_not_round ? ROUND_DOWN : ROUND_HALF_UP);
+    L.TrailTrim();
+    L.iterations = x.iterations;
     return L;
 }
 
 Decimal Decimal::Log(const Decimal &x, const Decimal &base) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
     return Ln(x)/Ln(base);
 }
 
 Decimal Decimal::Log10(const Decimal &x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
-    return Ln(x)/xFDCon::Ln10();
+    return Ln(x)/xFDCon::Ln10(x.iterations);
 }
 
 Decimal Decimal::Log2(const Decimal &x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    return Ln(x)/xFDCon::Ln2(x.iterations);
+}
+
+
+Decimal Decimal::ISqrt(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(x.IsNaN() || x.sign == '-' ? STATUS_INVALID : 0, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return x.IsNaN() || x.sign == '-' ? NaN() : x;
+    }
+    if (!x.IsInt() || x.IsNegative()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "Integer square root is only defined for non-negative integers");
+        return NaN();
     }
-    return Ln(x)/xFDCon::Ln2();
+    Decimal r;
+    return ISqrtNum(x, r);
+}
+
+bool Decimal::IsSquare(const Decimal& x) {
+    if (x.type != NumType::_NORMAL || !x.IsInt() || x.IsNegative()) {
+        return false;
+    }
+    Decimal r;
+    ISqrtNum(x, r);
+    return r.IsZero();
+}
+
+Decimal Decimal::Sqrt(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(x.IsNaN() || x.sign == '-' ? STATUS_INVALID : 0, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return x.IsNaN() || x.sign == '-' ? NaN() : x;
+    }
+    if (x.IsNegative()) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "Sqrt is undefined for negative numbers");
+        return NaN();
+    }
+    // sqrt(x) * 10^p = sqrt(x * 10^(2p)), and the floor of the root of
+    // the integer part equals the floor of the root of the whole.
+    int p = x.iterations.decimals;
+    Decimal n = x, r;
+    int shift = 2*p - x.decimals;
+    n.decimals = 0;
+    if (shift > 0)
+        n.ShiftDecimalPoint(shift);
+    bool dropped = false;
+    if (shift < 0) {
+        for (int i = 0; i < -shift && !dropped; i++)
+            dropped = n.number[i] != '0';
+        n.number.erase(n.number.begin(), n.number.begin() - shift);
+    }
+    if (n.number.empty())
+        n.number.push_back('0');
+
+    Decimal root = ISqrtNum(n, r);
+    if (dropped || !r.IsZero())
+        status_flags |= STATUS_INEXACT;
+    root.iterations = x.iterations;
+    root.decimals = p;
+    if (root.number.size() <= static_cast<size_t>(p))
+        root.number.insert(root.number.end(), p - root.number.size() + 1, '0');
+    root.LeadTrim();
+    root.TrailTrim();
+    return root;
+}
+
+Decimal Decimal::RSqrt(const Decimal& x) {
+    if (x.IsNaN() || x.IsInf()) {
+        Signal(x.IsNaN() || x.sign == '-' ? STATUS_INVALID : 0, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return x.IsNaN() || x.sign == '-' ? NaN() : 0_D;
+    }
+    if (x.IsNegative() || x.IsZero()) {
+        Signal(x.IsZero() ? STATUS_DIVISION_BY_ZERO : STATUS_INVALID, x.iterations.TOE(), "RSqrt is only defined for positive numbers");
+        return x.IsZero() ? Inf() : NaN();
+    }
+    // 10^p / sqrt(x) = sqrt(10^(2p) / x), so take the root of the
+    // integer quotient 10^(2p+d) / X where x = X / 10^d.
+    int p = x.iterations.decimals;
+    Decimal n(x.iterations), X = x, q, r;
+    n.type = NumType::_NORMAL;
+    n.number.assign(2*p + x.decimals, '0');
+    n.number.push_back('1');
+    X.decimals = 0;
+    X.LeadTrim();
+    DivModNum(n, X, q, r);
+    bool dropped = !r.IsZero();
+
+    Decimal root = ISqrtNum(q, r);
+    if (dropped || !r.IsZero())
+        status_flags |= STATUS_INEXACT;
+    root.iterations = x.iterations;
+    root.decimals = p;
+    if (root.number.size() <= static_cast<size_t>(p))
+        root.number.insert(root.number.end(), p - root.number.size() + 1, '0');
+    root.LeadTrim();
+    root.TrailTrim();
+    return root;
 }
 
 
 
 Decimal Decimal::Sin(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    Decimal hw;
+    if (HardwareEval(sinl, x, hw) || DDEval(DDSin, x, hw)) {
+        return hw;
     }
+    int places = x.iterations.decimals;
     Decimal term = x;
     Decimal n = 3_D;
     Decimal fact = 6_D;
-    Decimal _x2 = x*x;
-    Decimal _xp = _x2*x;
+    Decimal _x2 = Decimal::MulFixed(x, x, places);
+    Decimal _xp = Decimal::MulFixed(_x2, x, places);
     Decimal sign = -1_D;
     for (int i = 1; i <= x.iterations.trig; i++) {
         term += sign * _xp / fact;
-        _xp *= _x2;
+        _xp = Decimal::MulFixed(_xp, _x2, places);
         sign *= -1_D;
-        fact *= (n-1_D) * (n-2_D);
+        fact *= (n+1_D) * (n+2_D);
         n += 2_D;
     }
     return term;
@@ -1840,21 +3454,25 @@ Decimal Decimal::Sin(const Decimal& x) {
 
 Decimal Decimal::Cos(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
+    }
+    Decimal hw;
+    if (HardwareEval(cosl, x, hw) || DDEval(DDCos, x, hw)) {
+        return hw;
     }
+    int places = x.iterations.decimals;
     Decimal term = 1_D;
     Decimal n = 2_D;
     Decimal fact = 2_D;
-    Decimal _x2 = x*x;
+    Decimal _x2 = Decimal::MulFixed(x, x, places);
     Decimal _xp = _x2;
     Decimal sign = -1_D;
     for (int i = 1; i <= x.iterations.trig; i++) {
         term += sign * _xp / fact;
-        _xp *= _x2;
+        _xp = Decimal::MulFixed(_xp, _x2, places);
         sign *= -1_D;
-        fact *= (n-1_D) * (n-2_D);
+        fact *= (n+1_D) * (n+2_D);
         n += 2_D;
     }
     return term;
@@ -1862,26 +3480,21 @@ Decimal Decimal::Cos(const Decimal& x) {
 
 Decimal Decimal::Tan(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
     // There is no Taylor series for tangent!!
     // Fortunately we have an elemntary formula
     // at our disposal.
     Decimal sin = xFD::Sin(x);
-    if (sin == 0_D) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("Tan is not defined at the location \"Pi/2\" in the period");
-        }
-        else {
-            // At this point, there is a vertical asymptote, so it is positive
-            // and negative infinity at this point. Do not make any assumption
-            // the sign of this return value, positive was chosen arbitrarily
-            // but it could've been equally negative. My advise is to take the
-            // absolute value of any Infinity values in your tangent calculations.
-            return xFD::Inf();
-        }
+    if (sin.IsZero()) {
+        Signal(STATUS_DIVISION_BY_ZERO, x.iterations.TOE(), "Tan is not defined at the location \"Pi/2\" in the period");
+        // At this point, there is a vertical asymptote, so it is positive
+        // and negative infinity at this point. Do not make any assumption
+        // the sign of this return value, positive was chosen arbitrarily
+        // but it could've been equally negative. My advise is to take the
+        // absolute value of any Infinity values in your tangent calculations.
+        return xFD::Inf();
     }
     Decimal cos = xFD::Cos(x);
     return cos/sin;
@@ -1889,27 +3502,24 @@ Decimal Decimal::Tan(const Decimal& x) {
 
 Decimal Decimal::Cot(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
     return 1_D/xFD::Tan(x);
 }
 
 Decimal Decimal::Sec(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
     return 1_D/xFD::Cos(x);
 }
 
 Decimal Decimal::Csc(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
     return 1_D/xFD::Sin(x);
 }
@@ -1917,14 +3527,15 @@ Decimal Decimal::Csc(const Decimal& x) {
 
 Decimal Decimal::Asin(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
-    if (xFD::Abs(x) > 1_D) {
-        throw DecimalIllegalOperation("Inverse sine is only defined for -1 <= x <= 1");
+    if (x.CompareSmall(1) > 0 || x.CompareSmall(-1) < 0) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "Inverse sine is only defined for -1 <= x <= 1");
+        return NaN();
     }
 
+    int places = x.iterations.decimals;
     Decimal term = x;
     Decimal n = 1_D;
     Decimal _2n = 2_D;
@@ -1933,15 +3544,15 @@ Decimal Decimal::Asin(const Decimal& x) {
     Decimal ncr = 2_D;
     Decimal fact2 = 2_D;
     Decimal fact1 = 1_D;
-    Decimal _x2 = x*x;
-    Decimal _xp = _x2*x;
+    Decimal _x2 = Decimal::MulFixed(x, x, places);
+    Decimal _xp = Decimal::MulFixed(_x2, x, places);
     Decimal _22ni = 4_D;
     Decimal _22n = 4_D;
 
     for (int i = 1; i <= x.iterations.trig; i++) {
-        term += ncr/_22ni * _xp/(_2n+1_D);
-        _xp *= _x2;
-        fact2 *= (_2n+1_D) * (_2n*2_D);
+        term += Decimal::MulFixed(ncr/_22ni, _xp, places)/(_2n+1_D);
+        _xp = Decimal::MulFixed(_xp, _x2, places);
+        fact2 *= (_2n+1_D) * (_2n+2_D);
         fact1 *= n+1_D;
         ncr = fact2/(fact1*fact1);
         n += 1_D;
@@ -1953,51 +3564,52 @@ Decimal Decimal::Asin(const Decimal& x) {
 
 Decimal Decimal::Acos(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
-    if (xFD::Abs(x) > 1_D) {
-        throw DecimalIllegalOperation("Inverse cosine is only defined for -1 <= x <= 1");
+    if (x.CompareSmall(1) > 0 || x.CompareSmall(-1) < 0) {
+        Signal(STATUS_INVALID, x.iterations.TOE(), "Inverse cosine is only defined for -1 <= x <= 1");
+        return NaN();
     }
 
 
-    Decimal PI2 = xFDCon::Pi2();
+    Decimal PI2 = xFDCon::Pi2(x.iterations);
     return PI2 - Asin(x);
 }
 
 Decimal Decimal::Atan(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
-    if (xFD::Abs(x) < 1_D) {
+    int places = x.iterations.decimals;
+    if (x.CompareSmall(1) < 0 && x.CompareSmall(-1) > 0) {
         Decimal term = x;
         Decimal n = 3_D;
-        Decimal _x2 = x*x;
-        Decimal _xp = _x2*x;
+        Decimal _x2 = Decimal::MulFixed(x, x, places);
+        Decimal _xp = Decimal::MulFixed(_x2, x, places);
         Decimal sign = -1_D;
         
         for (int i = 1; i <= x.iterations.trig; i++) {
             term += sign*_xp/n;
-            _xp *= _x2;
+            _xp = Decimal::MulFixed(_xp, _x2, places);
             n += 2_D;
             sign *= -1_D;
         }
         return term;
     }
     else {
-        Decimal PI2 = xFDCon::Pi2();
-        Decimal term = PI2 * xFD::Sign(x);
+        // atan(x) = sign(x)*Pi/2 - 1/x + 1/(3x^3) - 1/(5x^5) + ...
+        Decimal PI2 = xFDCon::Pi2(x.iterations);
+        Decimal term = PI2 * xFD::Sign(x) - 1_D/x;
         Decimal n = 3_D;
-        Decimal _x2 = x*x;
-        Decimal _xp = _x2*x;
-        Decimal sign = -1_D;
+        Decimal _x2 = Decimal::MulFixed(x, x, places);
+        Decimal _xp = Decimal::MulFixed(_x2, x, places);
+        Decimal sign = 1_D;
 
         for (int i = 1; i <= x.iterations.trig; i++) {
             term += sign/(n*_xp);
-            _xp *= _x2;
+            _xp = Decimal::MulFixed(_xp, _x2, places);
             n += 2_D;
             sign *= -1_D;
         }
@@ -2008,25 +3620,25 @@ Decimal Decimal::Atan(const Decimal& x) {
 
 Decimal Decimal::Atan2(const Decimal& x, const Decimal& y) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
-    Decimal PI2 = xFDCon::Pi2();
-    if (y == 0_D) {
-        if (x.iterations.throw_on_error || y.iterations.throw_on_error) {
-            throw DecimalIllegalOperation("Inverse tangent on any angle on the same period as Pi/2 is undefined");
+    Decimal hw;
+    if (!y.IsZero() && HardwareEval(HardwareAtan2, x, y, hw)) {
+        return hw;
+    }
+    Decimal PI2 = xFDCon::Pi2(x.iterations);
+    if (y.IsZero()) {
+        Signal(x.IsZero() ? STATUS_INVALID : 0, x.iterations.throw_on_error || y.iterations.throw_on_error,
+                "Inverse tangent on any angle on the same period as Pi/2 is undefined");
+        if (x.IsZero()) {
+            return xFD::NaN();
+        }
+        else if (x.CompareSmall(0) > 0) {
+            return PI2;
         }
         else {
-            if (x == 0_D) {
-                return xFD::NaN();
-            }
-            else if (x > 0_D) {
-                return PI2;
-            }
-            else {
-                return xFD::TrigPhaseCorrect(PI2);
-            }
+            return xFD::TrigPhaseCorrect(PI2);
         }
     }
 
@@ -2038,46 +3650,96 @@ Decimal Decimal::Atan2(const Decimal& x, const Decimal& y) {
     // Sine and cosine are both negative in 3rd quadrant
     // Cosine is positive in 4th quadrant
     // Code uses https://en.wikipedia.org/wiki/Atan2#Definition_and_computation
-    if (x < 0_D && y >= 0_D) {
+    if (x.IsNegative() && !y.IsNegative()) {
         return xFD::TrigPhaseCorrect(term + 2_D*PI2);
     }
-    else if (x < 0_D && y < 0_D) {
+    else if (x.IsNegative() && y.IsNegative()) {
         return xFD::TrigPhaseCorrect(term - 2_D*PI2);
     }
-    else { // x > 0_D
+    else { // x > 0
         return term;
     }
 }
 
 Decimal Decimal::Acot(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
-    Decimal PI2 = xFDCon::Pi2();
+    Decimal PI2 = xFDCon::Pi2(x.iterations);
     return PI2 - Atan(x);
 }
 
 Decimal Decimal::Asec(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
     return Acos(1_D/x);
 }
 
 Decimal Decimal::Acsc(const Decimal &x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
-        }
+        Signal(STATUS_INVALID, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        return NaN();
     }
     return Asin(1_D/x);
 }
 
 //Comparators
+bool Decimal::IsZero() const noexcept
+{
+    if (type != NumType::_NORMAL)
+        return false;
+    for (auto it = number.rbegin(); it != number.rend(); ++it)
+        if (*it != '0')
+            return false;
+    return true;
+}
+
+bool Decimal::IsNegative() const noexcept
+{
+    return (type == NumType::_INFINITY && sign == '-') || (sign == '-' && !IsZero());
+}
+
+bool Decimal::IsOne() const noexcept
+{
+    return type == NumType::_NORMAL && CompareSmall(1) == 0;
+}
+
+int Decimal::CompareSmall(long long v) const
+{
+    return CompareInteger(Magnitude(v), v < 0);
+}
+
+int Decimal::CompareInteger(unsigned long long magnitude, bool negative) const
+{
+    if (type == NumType::_NAN)
+        throw DecimalIllegalOperation("Comparison with NaN");
+    if (type == NumType::_INFINITY)
+        return (sign == '-') ? -1 : 1;
+
+    // Integer part, `over` once it exceeds every 64-bit magnitude.
+    const unsigned long long top = ULLONG_MAX / 10;
+    unsigned long long ip = 0;
+    bool over = false, frac = false;
+    for (int i = static_cast<int>(number.size()) - 1; i >= decimals && !over; --i)
+    {
+        unsigned d = CharToInt(number[i]);
+        over = ip > top || (ip == top && d > ULLONG_MAX % 10);
+        ip = ip * 10 + d;
+    }
+    for (int i = 0; i < decimals && !frac; ++i)
+        frac = number[i] != '0';
+
+    bool neg = sign == '-' && (over || ip != 0 || frac);
+    negative = negative && magnitude != 0;
+    if (neg != negative)
+        return neg ? -1 : 1;
+    int cmp = (over || ip > magnitude || (ip == magnitude && frac)) ? 1 : (ip == magnitude ? 0 : -1);
+    return neg ? -cmp : cmp;
+}
+
 bool Decimal::operator== (const Decimal& right) const
 {
     int check = CompareNum(*this,right);
@@ -2418,13 +4080,36 @@ bool Decimal::FitsLongDouble() const {
 }
 
 
+template <typename T>
+T Decimal::ConversionFailure(const char* msg) const
+{
+    if (type == NumType::_NAN) {
+        Signal(STATUS_INVALID, iterations.TOE(), msg);
+        return 0;
+    }
+    const T lo = std::numeric_limits<T>::min(), hi = std::numeric_limits<T>::max();
+    bool negative = sign == '-';
+    if (type == NumType::_INFINITY || (negative ? CompareInteger(Magnitude(lo), lo != 0) < 0
+                : CompareInteger(static_cast<unsigned long long>(hi), false) > 0)) {
+        Signal(STATUS_OVERFLOW, iterations.TOE(), msg);
+        return negative ? lo : hi;
+    }
+
+    // In range, so only the fraction stood in the way.
+    Signal(STATUS_INEXACT, iterations.TOE(), msg);
+    unsigned long long magnitude = 0;
+    for (size_t i = number.size(); i-- > static_cast<size_t>(decimals); )
+        magnitude = magnitude * 10 + CharToInt(number[i]);
+    return static_cast<T>(negative ? 0ULL - magnitude : magnitude);
+}
+
 char Decimal::ToChar8() const
 {
     char var = 0;
 
     if(!this->FitsChar8())
     {
-        throw DecimalIllegalOperation("Decimal cannot be converted to Char8");
+        return ConversionFailure<char>("Decimal cannot be converted to Char8");
     }
 
     int dec = 1;
@@ -2447,7 +4132,7 @@ unsigned char Decimal::ToUChar8() const
 
     if(!this->FitsUChar8())
     {
-        throw DecimalIllegalOperation("Decimal cannot be converted to UChar8");
+        return ConversionFailure<unsigned char>("Decimal cannot be converted to UChar8");
     }
 
     int dec = 1;
@@ -2467,7 +4152,7 @@ short Decimal::ToShort16() const
 
     if(!this->FitsShort16())
     {
-        throw DecimalIllegalOperation("Decimal cannot be converted to Short16");
+        return ConversionFailure<short>("Decimal cannot be converted to Short16");
     }
 
     int dec = 1;
@@ -2490,7 +4175,7 @@ unsigned short Decimal::ToUShort16() const
 
     if(!this->FitsUShort16())
     {
-        throw DecimalIllegalOperation("Decimal cannot be converted to UShort16");
+        return ConversionFailure<unsigned short>("Decimal cannot be converted to UShort16");
     }
 
     int dec = 1;
@@ -2510,7 +4195,7 @@ int Decimal::ToInt32() const
 
     if(!this->FitsInt32())
     {
-        throw DecimalIllegalOperation("Decimal cannot be converted to Int32");
+        return ConversionFailure<int>("Decimal cannot be converted to Int32");
     }
 
     int dec = 1;
@@ -2533,7 +4218,7 @@ unsigned int Decimal::ToUInt32() const
 
     if(!this->FitsUInt32())
     {
-        throw DecimalIllegalOperation("Decimal cannot be converted to UInt32");
+        return ConversionFailure<unsigned int>("Decimal cannot be converted to UInt32");
     }
 
     unsigned int dec = 1;
@@ -2553,7 +4238,7 @@ long Decimal::ToLong64() const
 
     if(!this->FitsLong64())
     {
-        throw DecimalIllegalOperation("Decimal cannot be converted to Long64");
+        return ConversionFailure<long>("Decimal cannot be converted to Long64");
     }
 
     long dec = 1;
@@ -2576,7 +4261,7 @@ unsigned long Decimal::ToULong64() const
 
     if(!this->FitsULong64())
     {
-        throw DecimalIllegalOperation("Decimal cannot be converted to ULong64");
+        return ConversionFailure<unsigned long>("Decimal cannot be converted to ULong64");
     }
 
     unsigned long dec = 1;
@@ -2596,7 +4281,7 @@ long long Decimal::ToLongLong64() const
 
     if(!this->FitsLongLong64())
     {
-        throw DecimalIllegalOperation("Decimal cannot be converted to LongLong64");
+        return ConversionFailure<long long>("Decimal cannot be converted to LongLong64");
     }
 
     long long dec = 1;
@@ -2619,7 +4304,7 @@ unsigned long long Decimal::ToULongLong64() const
 
     if(!this->FitsULongLong64())
     {
-        throw DecimalIllegalOperation("Decimal cannot be converted to ULongLong64");
+        return ConversionFailure<unsigned long long>("Decimal cannot be converted to ULongLong64");
     }
 
     unsigned long long dec = 1;
@@ -2819,71 +4504,18 @@ std::string Decimal::ToHex(bool lowercase) const {
     if (IsNaN() || IsInf() || !IsInt()) {
         throw DecimalIllegalOperation("can only convert integers to hex");
     }
-    if (*this == 0_D) {
+    if (IsZero()) {
         return "00";
     }
+    const char* digits = (lowercase) ? "0123456789abcdef" : "0123456789ABCDEF";
     std::string out, scratch;
     if (sign == '-') {
         out += "-";
     }
-    Decimal q = xFD::Floor(*this);
-    Decimal r = q;
-    Decimal _16 = 16_D;
+    DecimalInt q(xFD::Abs(*this));
 
-    while (q > 0_D) {
-        r = q % _16;
-        q = xFD::Floor(q /_16);
-        if (r == 0_D) {
-            scratch += "0";
-        }
-        else if (r == 1_D) {
-            scratch += "1";
-        }
-        else if (r == 2_D) {
-            scratch += "2";
-        }
-        else if (r == 3_D) {
-            scratch += "3";
-        }
-        else if (r == 4_D) {
-            scratch += "4";
-        }
-        else if (r == 5_D) {
-            scratch += "5";
-        }
-        else if (r == 6_D) {
-            scratch += "6";
-        }
-        else if (r == 7_D) {
-            scratch += "7";
-        }
-        else if (r == 8_D) {
-            scratch += "8";
-        }
-        else if (r == 9_D) {
-            scratch += "9";
-        }
-        else if (r == 10_D) {
-            scratch += (lowercase) ? "a" : "A";
-        }
-        else if (r == 11_D) {
-            scratch += (lowercase) ? "b" : "B";
-        }
-        else if (r == 12_D) {
-            scratch += (lowercase) ? "c" : "C";
-        }
-        else if (r == 13_D) {
-            scratch += (lowercase) ? "d" : "D";
-        }
-        else if (r == 14_D) {
-            scratch += (lowercase) ? "e" : "E";
-        }
-        else if (r == 15_D) {
-            scratch += (lowercase) ? "f" : "F";
-        }
-        else {
-            throw DecimalIllegalOperation("Invalid number");
-        }
+    while (!q.IsZero()) {
+        scratch += digits[q.DivSmall(16)];
     }
     if (scratch.length() % 2 != 0) {
         scratch += "0";
@@ -2896,12 +4528,9 @@ std::string Decimal::ToHex(bool lowercase) const {
 
 // Normalizes numbers between 0 and 2*Pi.
 Decimal Decimal::TrigPhaseCorrect(const Decimal& x) {
-    Decimal _2PI = xFDCon::_2Pi();
+    Decimal _2PI = xFDCon::Pi(x.iterations) * 2;
     Decimal delta = xFD::Floor(x/_2PI);
-    if (delta < 0_D) {
-        return x + _2PI*delta;
-    }
-    else if (delta > 0_D) {
+    if (!delta.IsZero()) {
         return x - _2PI*delta;
     }
     else {
@@ -2915,40 +4544,103 @@ void Decimal::SetPrecision(int prec)
         return;
     if(this->decimals<prec)
     {
-        while (this->decimals<prec)
-        {
-            this->decimals++;
-            this->number.push_front('0');
-        }
+        this->number.insert(this->number.begin(), prec - this->decimals, '0');
+        this->decimals = prec;
     }
     else if(this->decimals>prec)
     {
-        char last;
-        while (this->decimals>prec)
-        {
-            last=number[0];
-            this->decimals--;
-            this->number.pop_front();
-        }
-        if(CharToInt(last)>=5)
-        {
-            if(prec==0)
-                (*this)++;
-            else
-            {
-                std::stringstream ss;
-                ss<<"0.";
-                for( int i=1; i<prec; i++)
-                    ss<<"0";
-                ss<<"1";
-                Decimal aus(ss.str());
-                *this = *this + aus;
-            }
-        }
+        RoundTo(prec, ROUND_HALF_UP);
+    }
+    if (iterations.decimals < decimals) {
+        iterations.decimals = decimals;
+    }
+};
+
+void Decimal::ShiftDecimalPoint(int k)
+{
+    if (type != NumType::_NORMAL || k == 0)
+        return;
+    decimals -= k;
+    if (decimals < 0) {
+        number.insert(number.begin(), -decimals, '0');
+        decimals = 0;
     }
+    else if (number.size() <= static_cast<size_t>(decimals)) {
+        number.insert(number.end(), decimals + 1 - number.size(), '0');
+    }
+    LeadTrim();
     if (iterations.decimals < decimals) {
         iterations.decimals = decimals;
     }
+}
+
+void Decimal::RoundTo(int places, RoundingMode mode)
+{
+    if (type != NumType::_NORMAL || decimals <= places)
+        return;
+
+    // Number of low digits to drop. When places is negative this reaches
+    // into the integer part, so make sure the digit kept above exists.
+    size_t drop = decimals - places;
+    if (number.size() < drop + 1)
+        number.insert(number.end(), drop + 1 - number.size(), '0');
+
+    char first = number[drop-1];
+    bool rest = false;
+    for (size_t i = 0; i + 1 < drop && !rest; i++)
+        rest = number[i] != '0';
+    bool inexact = first != '0' || rest;
+    if (inexact)
+        status_flags |= STATUS_INEXACT;
+
+    bool up = false;
+    switch (mode) {
+    case ROUND_HALF_EVEN:
+        up = first > '5' || (first == '5' && (rest || CharToInt(number[drop]) % 2 == 1));
+        break;
+    case ROUND_HALF_UP:
+        up = first >= '5';
+        break;
+    case ROUND_DOWN:
+        break;
+    case ROUND_UP:
+        up = inexact;
+        break;
+    case ROUND_FLOOR:
+        up = inexact && sign == '-';
+        break;
+    case ROUND_CEILING:
+        up = inexact && sign == '+';
+        break;
+    }
+
+    number.erase(number.begin(), number.begin() + drop);
+    for (size_t i = 0; up && i < number.size(); i++) {
+        if (number[i] == '9') {
+            number[i] = '0';
+        }
+        else {
+            ++number[i];
+            up = false;
+        }
+    }
+    if (up)
+        number.push_back('1');
+
+    if (places < 0) {
+        decimals = 0;
+        ShiftDecimalPoint(-places);
+    }
+    else {
+        decimals = places;
+    }
+    LeadTrim();
+
+    bool zero = true;
+    for (size_t i = 0; i < number.size() && zero; i++)
+        zero = number[i] == '0';
+    if (zero)
+        sign = '+';
 };
 
 //Remove leading zeros of numbers, utilized by Operations without sign
@@ -2976,8 +4668,9 @@ void Decimal::TrailTrim()
 //Math/Scientific Methods
 Decimal Decimal::Abs(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
+        Signal(0, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        if (x.IsNaN()) {
+            return x;
         }
     }
     Decimal a = x;
@@ -2987,8 +4680,9 @@ Decimal Decimal::Abs(const Decimal& x) {
 
 Decimal Decimal::Sign(const Decimal& x) {
     if (x.IsNaN() || x.IsInf()) {
-        if (x.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
+        Signal(0, x.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        if (x.IsNaN()) {
+            return x;
         }
     }
     if (x.sign == '+') {
@@ -3005,8 +4699,9 @@ Decimal Decimal::Sign(const Decimal& x) {
 Decimal Decimal::operator-() const {
     Decimal a = *this;
     if (a.IsNaN() || a.IsInf()) {
-        if (a.iterations.TOE()) {
-            throw DecimalIllegalOperation("IEE754 special number arithmetic is disabled");
+        Signal(0, a.iterations.TOE(), "IEE754 special number arithmetic is disabled");
+        if (a.IsNaN()) {
+            return a;
         }
     }
     if (a.sign == '+') {
@@ -0,0 +1,681 @@
+// Generated by digits, do not edit.
+#define DECIMAL_DIGITS_PLACES 5000
+
+static const char* const DECIMAL_DIGITS[] = {
+    // e
+    "2.71828182845904523536028747135266249775724709369995957496696762772407663035354759457138217852516642"
+    "7427466391932003059921817413596629043572900334295260595630738132328627943490763233829880753195251019"
+    "0115738341879307021540891499348841675092447614606680822648001684774118537423454424371075390777449920"
+    "6955170276183860626133138458300075204493382656029760673711320070932870912744374704723069697720931014"
+    "1692836819025515108657463772111252389784425056953696770785449969967946864454905987931636889230098793"
+    "1277361782154249992295763514822082698951936680331825288693984964651058209392398294887933203625094431"
+    "1730123819706841614039701983767932068328237646480429531180232878250981945581530175671736133206981125"
+    "0996181881593041690351598888519345807273866738589422879228499892086805825749279610484198444363463244"
+    "9684875602336248270419786232090021609902353043699418491463140934317381436405462531520961836908887070"
+    "1676839642437814059271456354906130310720851038375051011574770417189861068739696552126715468895703503"
+    "5402123407849819334321068170121005627880235193033224745015853904730419957777093503660416997329725088"
+    "6876966403555707162268447162560798826517871341951246652010305921236677194325278675398558944896970964"
+    "0975459185695638023637016211204774272283648961342251644507818244235294863637214174023889344124796357"
+    "4370263755294448337998016125492278509257782562092622648326277933386566481627725164019105900491644998"
+    "2893150566047258027786318641551956532442586982946959308019152987211725563475463964479101459040905862"
+    "9849679128740687050489585867174798546677575732056812884592054133405392200011378630094556068816674001"
+    "6984205580403363795376452030402432256613527836951177883863874439662532249850654995886234281899707733"
+    "2761717839280349465014345588970719425863987727547109629537415211151368350627526023264847287039207643"
+    "1005958411661205452970302364725492966693811513732275364509888903136020572481765851180630364428123149"
+    "6550704751025446501172721155519486685080036853228183152196003735625279449515828418829478761085263981"
+    "3955990067376482922443752871846245780361929819713991475644882626039033814418232625150974827987779964"
+    "3730899703888677822713836057729788241256119071766394650706330452795466185509666618566470971134447401"
+    "6070462621568071748187784437143698821855967095910259686200235371858874856965220005031173439207321139"
+    "0803293634479727355955277349071783793421637012050054513263835440001863239914907054797780566978533580"
+    "4896690629511943247309958765523681285904138324116072260299833053537087613893963917795745401613722361"
+    "8789365260538155841587186925538606164779834025435128439612946035291332594279490433729908573158029095"
+    "8631382683291477116396337092400316894586360606458459251269946557248391865642097526850823075442545993"
+    "7691704197778008536273094171016343490769642372229435236612557250881477922315197477806056967253801718"
+    "0776360346245927877846585065605078084421152969752189087401966090665180351650179250461950136658543663"
+    "2712549639908549144200014574760819302212066024330096412704894390397177195180699086998606636583232278"
+    "7093765022601492910115171776359446020232493002804018677239102880978666056511832600436885088171572386"
+    "6984224220102495055188169480322100251542649463981287367765892768816359831247788652014117411091360116"
+    "4995076629077943646005851941998560162647907615321038727557126992518275687989302761761146162549356495"
+    "9037980458381823233686120162437365698467037858533052758333379399075216606923805336988795651372855938"
+    "8349989470741618155012539706464817194670834819721448889879067650379590366967249499254527903372963616"
+    "2658976039498576741397359441023744329709355477982629614591442936451428617158587339746791897571211956"
+    "1873857836447584484235555810500256114923915188930994634284139360803830916628188115037152849670597416"
+    "2562823609216807515017772538740256425347087908913729172282861151591568372524163077225440633787593105"
+    "9826760944203261924285317018781772960235413060672136046000389661093647095141417185777014180606443636"
+    "8154644400533160877831431744408119494229755993140118886833148328027065538330046932901157441475631399"
+    "9722170380461709289457909627166226074071874997535921275608441473782330327033016823719364800217328573"
+    "4935947564334129943024850235732214597843282641421684878721673367010615094243456984401873312810107945"
+    "1272237378861260581656680537143961278887325273738903928905068653241380627960259303877276977837928684"
+    "0932536588073398845721874602100531148335132385004782716937621800490479559795929059165547050577751430"
+    "8175112698985188408718564026035305583737832422924185625644255022672155980274012617971928047139600689"
+    "1638286652770097527670697770364392602243728418408832518487704726384403795301669054659374616193238403"
+    "6389313136432713768884102681121989127522305625675625470172508634976536728860596675274086862740791285"
+    "6576996313789753034660616669804218267724560530660773899624218340859882071864682623215080288286359746"
+    "8396543588566855037731312965879758105012149162076567699506597153447634703208532156036748286083786568"
+    "0307306265763346977429563464371670939719306087696349532884683361303882943104080029687386911706666614"
+    "68",
+    // Pi
+    "3.14159265358979323846264338327950288419716939937510582097494459230781640628620899862803482534211706"
+    "7982148086513282306647093844609550582231725359408128481117450284102701938521105559644622948954930381"
+    "9644288109756659334461284756482337867831652712019091456485669234603486104543266482133936072602491412"
+    "7372458700660631558817488152092096282925409171536436789259036001133053054882046652138414695194151160"
+    "9433057270365759591953092186117381932611793105118548074462379962749567351885752724891227938183011949"
+    "1298336733624406566430860213949463952247371907021798609437027705392171762931767523846748184676694051"
+    "3200056812714526356082778577134275778960917363717872146844090122495343014654958537105079227968925892"
+    "3542019956112129021960864034418159813629774771309960518707211349999998372978049951059731732816096318"
+    "5950244594553469083026425223082533446850352619311881710100031378387528865875332083814206171776691473"
+    "0359825349042875546873115956286388235378759375195778185778053217122680661300192787661119590921642019"
+    "8938095257201065485863278865936153381827968230301952035301852968995773622599413891249721775283479131"
+    "5155748572424541506959508295331168617278558890750983817546374649393192550604009277016711390098488240"
+    "1285836160356370766010471018194295559619894676783744944825537977472684710404753464620804668425906949"
+    "1293313677028989152104752162056966024058038150193511253382430035587640247496473263914199272604269922"
+    "7967823547816360093417216412199245863150302861829745557067498385054945885869269956909272107975093029"
+    "5532116534498720275596023648066549911988183479775356636980742654252786255181841757467289097777279380"
+    "0081647060016145249192173217214772350141441973568548161361157352552133475741849468438523323907394143"
+    "3345477624168625189835694855620992192221842725502542568876717904946016534668049886272327917860857843"
+    "8382796797668145410095388378636095068006422512520511739298489608412848862694560424196528502221066118"
+    "6306744278622039194945047123713786960956364371917287467764657573962413890865832645995813390478027590"
+    "0994657640789512694683983525957098258226205224894077267194782684826014769909026401363944374553050682"
+    "0349625245174939965143142980919065925093722169646151570985838741059788595977297549893016175392846813"
+    "8268683868942774155991855925245953959431049972524680845987273644695848653836736222626099124608051243"
+    "8843904512441365497627807977156914359977001296160894416948685558484063534220722258284886481584560285"
+    "0601684273945226746767889525213852254995466672782398645659611635488623057745649803559363456817432411"
+    "2515076069479451096596094025228879710893145669136867228748940560101503308617928680920874760917824938"
+    "5890097149096759852613655497818931297848216829989487226588048575640142704775551323796414515237462343"
+    "6454285844479526586782105114135473573952311342716610213596953623144295248493718711014576540359027993"
+    "4403742007310578539062198387447808478489683321445713868751943506430218453191048481005370614680674919"
+    "2781911979399520614196634287544406437451237181921799983910159195618146751426912397489409071864942319"
+    "6156794520809514655022523160388193014209376213785595663893778708303906979207734672218256259966150142"
+    "1503068038447734549202605414665925201497442850732518666002132434088190710486331734649651453905796268"
+    "5610055081066587969981635747363840525714591028970641401109712062804390397595156771577004203378699360"
+    "0723055876317635942187312514712053292819182618612586732157919841484882916447060957527069572209175671"
+    "1672291098169091528017350671274858322287183520935396572512108357915136988209144421006751033467110314"
+    "1267111369908658516398315019701651511685171437657618351556508849099898599823873455283316355076479185"
+    "3589322618548963213293308985706420467525907091548141654985946163718027098199430992448895757128289059"
+    "2323326097299712084433573265489382391193259746366730583604142813883032038249037589852437441702913276"
+    "5618093773444030707469211201913020330380197621101100449293215160842444859637669838952286847831235526"
+    "5821314495768572624334418930396864262434107732269780280731891544110104468232527162010526522721116603"
+    "9666557309254711055785376346682065310989652691862056476931257058635662018558100729360659876486117910"
+    "4533488503461136576867532494416680396265797877185560845529654126654085306143444318586769751456614068"
+    "0070023787765913440171274947042056223053899456131407112700040785473326993908145466464588079727082668"
+    "3063432858785698305235808933065757406795457163775254202114955761581400250126228594130216471550979259"
+    "2309907965473761255176567513575178296664547791745011299614890304639947132962107340437518957359614589"
+    "0193897131117904297828564750320319869151402870808599048010941214722131794764777262241425485454033215"
+    "7185306142288137585043063321751829798662237172159160771669254748738986654949450114654062843366393790"
+    "0397692656721463853067360965712091807638327166416274888800786925602902284721040317211860820419000422"
+    "9661711963779213375751149595015660496318629472654736425230817703675159067350235072835405670403867435"
+    "1362222477158915049530984448933309634087807693259939780541934144737744184263129860809988868741326047"
+    "21",
+    // 1/Pi
+    "0.31830988618379067153776752674502872406891929148091289749533468811779359526845307018022760553250617"
+    "1912145685453515916073785823692229157305755934821463399678458479933874818155146155492793850615377434"
+    "7857924347953233867247804834472580236647602284453995114318809237801738053479122409788218738756881710"
+    "5744619989288680049734469547891922179664619356614981233397292560939889730437576314957313392848207799"
+    "1748278697219967736198399924885751170342357716862235037534321093095073976019478920729518667536118604"
+    "9889932706106543135510064406495556327943320458934962391963316812120336060719962678239749976655733088"
+    "7055951014003248135512877769914262176024439875229536275552947578126613609291595696352262485462813992"
+    "1550049000595519714178113805593570263050420032635492041849623212481122912406292968178496918382870423"
+    "1508151124017430532136044343182815149491654451954925707997503106587816279635448187165095941466574380"
+    "8139995181531541569869407871796561743468512807337902332509141188665526253730005224543594230642251990"
+    "0877335890075251121672634233905195162564498832466686290212247073757126227273384334284139493920258501"
+    "1566721062392171890196791134374199094930208632476310351616788859599419990105087751322588917666136921"
+    "0157058303028208097859770127763215523939861468207799915738378119618747554412375086445437860273251052"
+    "2477560775077762213628135308681656557053866853599112141580772120705477992490251991498552594047188191"
+    "1686023296592823711554248115088989140435795395848189806545895404332992071306363070880076813797494353"
+    "8317752638193301392880955394137536731355620955959090070679151660376367737587553224962990611993116043"
+    "8167197502070254258086463160997439373755518931326924420684088817109957007585477388587073238755658574"
+    "7187568694064604742916758471142372726838589203663645839283300175661586627069955819949172985805349012"
+    "1978737818917661006740610761094624643161886395352064566262837961949964487667034871397969500207900136"
+    "7760079573447199216048005478021749909709575847136522279897806537994854166992229841657807553569486071"
+    "0091369121673429586169134466540709707851124041736786481991244235066367880419415871415499309976173721"
+    "3272193732393407494908420566243850369244966998232229913311207593935227986256599215521655598020156607"
+    "2004676545975817080477523114890861852023820108675996778093098424965903214145706010454420472035046626"
+    "3463595186221006563102187478272792906115852143601672359097534492919609479545848962184018742515738366"
+    "6579177256798087173733327951346890281900727465438348622776132766145184605519469012109642555607413067"
+    "5566064341975469933136981600653977013483582929367016563233706628672321461990299706239639467516888419"
+    "6833119083045012867886257288807677671230175954329003412941350375491211832174337157158784524695126634"
+    "2226599731188319378143970137748846011503839541138007643678512440677484707251361670831303459421762344"
+    "3591873665129770374999497417106233196612202784289089203229769055405022822140497043479490207733472807"
+    "7457201993497863471236241423480957798737773113846156970046114114288127277264047370402148201149718456"
+    "2231443936007956495190600333917044246069283754730087093529291313194380224616953419861941718256729333"
+    "8383553877582866631133013396264328304201791423457247685214135690352022269016013989536844713979249761"
+    "0315519619067941617095011950725312980687889084116357728713660840006301911894868785050897013498285817"
+    "2950288460664266491390232698913550787884807218108766710565848684406989687323029326457204955333320990"
+    "6281314687151060281816559761829573386869845475205269995659914036323928642466280951525794968165782348"
+    "1949565275798363399878974995430397963745332589203661079166550418472701370777845693649451994505660153"
+    "3713875167319445839648859494812327636622791661348869703385719476647478532480486900399561988080437922"
+    "6966854722735289982765430833212684965872748370122452217226423997266925694198836798854859118312566679"
+    "8096076423500232242333441038251586071058584822688062322682249906367718539169808876936156981947965617"
+    "7105940903061079828019773976817673096733044493372481745080280801823574842440904615066947945076298807"
+    "7683811736846231892645488678132250324786212566390647766784263069112763023504070217491911640224750871"
+    "9536310680374814788680726795607763442009063383659038975918353479083557584870552348144921187832054645"
+    "6575893638729825789942990686510544718331859614495997161225380146643768905358867009116039049851326124"
+    "0975323226873067984057509041711068828819810259654549093182362644465681023332313014196751148674590972"
+    "6240822434327618312123223314640001666122292123625606525173919032049264332277153229609439865415542632"
+    "8824031899202212656610415191669700610158191169965964373480579677102766479140416152795100858451969529"
+    "4142032853948769008618331729056720649867208709314475115832273264824091561993943132680443176109158862"
+    "6565560110492264177803748424218489782082010430993619422744150801142192681328627149087983195388715778"
+    "4158685123556604447402297284985047849745742626404353347215132911965452191483132046875748725826421949"
+    "7179430142614782081452870828359411444530959607630255191582480050689360964405234684598002040966124926"
+    "06",
+    // Pi/2
+    "1.57079632679489661923132169163975144209858469968755291048747229615390820314310449931401741267105853"
+    "3991074043256641153323546922304775291115862679704064240558725142051350969260552779822311474477465190"
+    "9822144054878329667230642378241168933915826356009545728242834617301743052271633241066968036301245706"
+    "3686229350330315779408744076046048141462704585768218394629518000566526527441023326069207347597075580"
+    "4716528635182879795976546093058690966305896552559274037231189981374783675942876362445613969091505974"
+    "5649168366812203283215430106974731976123685953510899304718513852696085881465883761923374092338347025"
+    "6600028406357263178041389288567137889480458681858936073422045061247671507327479268552539613984462946"
+    "1771009978056064510980432017209079906814887385654980259353605674999999186489024975529865866408048159"
+    "2975122297276734541513212611541266723425176309655940855050015689193764432937666041907103085888345736"
+    "5179912674521437773436557978143194117689379687597889092889026608561340330650096393830559795460821009"
+    "9469047628600532742931639432968076690913984115150976017650926484497886811299706945624860887641739565"
+    "7577874286212270753479754147665584308639279445375491908773187324696596275302004638508355695049244120"
+    "0642918080178185383005235509097147779809947338391872472412768988736342355202376732310402334212953474"
+    "5646656838514494576052376081028483012029019075096755626691215017793820123748236631957099636302134961"
+    "3983911773908180046708608206099622931575151430914872778533749192527472942934634978454636053987546514"
+    "7766058267249360137798011824033274955994091739887678318490371327126393127590920878733644548888639690"
+    "0040823530008072624596086608607386175070720986784274080680578676276066737870924734219261661953697071"
+    "6672738812084312594917847427810496096110921362751271284438358952473008267334024943136163958930428921"
+    "9191398398834072705047694189318047534003211256260255869649244804206424431347280212098264251110533059"
+    "3153372139311019597472523561856893480478182185958643733882328786981206945432916322997906695239013795"
+    "0497328820394756347341991762978549129113102612447038633597391342413007384954513200681972187276525341"
+    "0174812622587469982571571490459532962546861084823075785492919370529894297988648774946508087696423406"
+    "9134341934471387077995927962622976979715524986262340422993636822347924326918368111313049562304025621"
+    "9421952256220682748813903988578457179988500648080447208474342779242031767110361129142443240792280142"
+    "5300842136972613373383944762606926127497733336391199322829805817744311528872824901779681728408716205"
+    "6257538034739725548298047012614439855446572834568433614374470280050751654308964340460437380458912469"
+    "2945048574548379926306827748909465648924108414994743613294024287820071352387775661898207257618731171"
+    "8227142922239763293391052557067736786976155671358305106798476811572147624246859355507288270179513996"
+    "7201871003655289269531099193723904239244841660722856934375971753215109226595524240502685307340337459"
+    "6390955989699760307098317143772203218725618590960899991955079597809073375713456198744704535932471159"
+    "8078397260404757327511261580194096507104688106892797831946889354151953489603867336109128129983075071"
+    "0751534019223867274601302707332962600748721425366259333001066217044095355243165867324825726952898134"
+    "2805027540533293984990817873681920262857295514485320700554856031402195198797578385788502101689349680"
+    "0361527938158817971093656257356026646409591309306293366078959920742441458223530478763534786104587835"
+    "5836145549084545764008675335637429161143591760467698286256054178957568494104572210503375516733555157"
+    "0633555684954329258199157509850825755842585718828809175778254424549949299911936727641658177538239592"
+    "6794661309274481606646654492853210233762953545774070827492973081859013549099715496224447878564144529"
+    "6161663048649856042216786632744691195596629873183365291802071406941516019124518794926218720851456638"
+    "2809046886722015353734605600956510165190098810550550224646607580421222429818834919476143423915617763"
+    "2910657247884286312167209465198432131217053866134890140365945772055052234116263581005263261360558301"
+    "9833278654627355527892688173341032655494826345931028238465628529317831009279050364680329938243058955"
+    "2266744251730568288433766247208340198132898938592780422764827063327042653071722159293384875728307034"
+    "0035011893882956720085637473521028111526949728065703556350020392736663496954072733232294039863541334"
+    "1531716429392849152617904466532878703397728581887627101057477880790700125063114297065108235775489629"
+    "6154953982736880627588283756787589148332273895872505649807445152319973566481053670218759478679807294"
+    "5096948565558952148914282375160159934575701435404299524005470607361065897382388631120712742727016607"
+    "8592653071144068792521531660875914899331118586079580385834627374369493327474725057327031421683196895"
+    "0198846328360731926533680482856045903819163583208137444400393462801451142360520158605930410209500211"
+    "4830855981889606687875574797507830248159314736327368212615408851837579533675117536417702835201933717"
+    "5681111238579457524765492224466654817043903846629969890270967072368872092131564930404994434370663023"
+    "60",
+    // Pi/4
+    "0.78539816339744830961566084581987572104929234984377645524373614807695410157155224965700870633552926"
+    "6995537021628320576661773461152387645557931339852032120279362571025675484630276389911155737238732595"
+    "4911072027439164833615321189120584466957913178004772864121417308650871526135816620533484018150622853"
+    "1843114675165157889704372038023024070731352292884109197314759000283263263720511663034603673798537790"
+    "2358264317591439897988273046529345483152948276279637018615594990687391837971438181222806984545752987"
+    "2824584183406101641607715053487365988061842976755449652359256926348042940732941880961687046169173512"
+    "8300014203178631589020694644283568944740229340929468036711022530623835753663739634276269806992231473"
+    "0885504989028032255490216008604539953407443692827490129676802837499999593244512487764932933204024079"
+    "6487561148638367270756606305770633361712588154827970427525007844596882216468833020953551542944172868"
+    "2589956337260718886718278989071597058844689843798944546444513304280670165325048196915279897730410504"
+    "9734523814300266371465819716484038345456992057575488008825463242248943405649853472812430443820869782"
+    "8788937143106135376739877073832792154319639722687745954386593662348298137651002319254177847524622060"
+    "0321459040089092691502617754548573889904973669195936236206384494368171177601188366155201167106476737"
+    "2823328419257247288026188040514241506014509537548377813345607508896910061874118315978549818151067480"
+    "6991955886954090023354304103049811465787575715457436389266874596263736471467317489227318026993773257"
+    "3883029133624680068899005912016637477997045869943839159245185663563196563795460439366822274444319845"
+    "0020411765004036312298043304303693087535360493392137040340289338138033368935462367109630830976848535"
+    "8336369406042156297458923713905248048055460681375635642219179476236504133667012471568081979465214460"
+    "9595699199417036352523847094659023767001605628130127934824622402103212215673640106049132125555266529"
+    "6576686069655509798736261780928446740239091092979321866941164393490603472716458161498953347619506897"
+    "5248664410197378173670995881489274564556551306223519316798695671206503692477256600340986093638262670"
+    "5087406311293734991285785745229766481273430542411537892746459685264947148994324387473254043848211703"
+    "4567170967235693538997963981311488489857762493131170211496818411173962163459184055656524781152012810"
+    "9710976128110341374406951994289228589994250324040223604237171389621015883555180564571221620396140071"
+    "2650421068486306686691972381303463063748866668195599661414902908872155764436412450889840864204358102"
+    "8128769017369862774149023506307219927723286417284216807187235140025375827154482170230218690229456234"
+    "6472524287274189963153413874454732824462054207497371806647012143910035676193887830949103628809365585"
+    "9113571461119881646695526278533868393488077835679152553399238405786073812123429677753644135089756998"
+    "3600935501827644634765549596861952119622420830361428467187985876607554613297762120251342653670168729"
+    "8195477994849880153549158571886101609362809295480449995977539798904536687856728099372352267966235579"
+    "9039198630202378663755630790097048253552344053446398915973444677075976744801933668054564064991537535"
+    "5375767009611933637300651353666481300374360712683129666500533108522047677621582933662412863476449067"
+    "1402513770266646992495408936840960131428647757242660350277428015701097599398789192894251050844674840"
+    "0180763969079408985546828128678013323204795654653146683039479960371220729111765239381767393052293917"
+    "7918072774542272882004337667818714580571795880233849143128027089478784247052286105251687758366777578"
+    "5316777842477164629099578754925412877921292859414404587889127212274974649955968363820829088769119796"
+    "3397330654637240803323327246426605116881476772887035413746486540929506774549857748112223939282072264"
+    "8080831524324928021108393316372345597798314936591682645901035703470758009562259397463109360425728319"
+    "1404523443361007676867302800478255082595049405275275112323303790210611214909417459738071711957808881"
+    "6455328623942143156083604732599216065608526933067445070182972886027526117058131790502631630680279150"
+    "9916639327313677763946344086670516327747413172965514119232814264658915504639525182340164969121529477"
+    "6133372125865284144216883123604170099066449469296390211382413531663521326535861079646692437864153517"
+    "0017505946941478360042818736760514055763474864032851778175010196368331748477036366616147019931770667"
+    "0765858214696424576308952233266439351698864290943813550528738940395350062531557148532554117887744814"
+    "8077476991368440313794141878393794574166136947936252824903722576159986783240526835109379739339903647"
+    "2548474282779476074457141187580079967287850717702149762002735303680532948691194315560356371363508303"
+    "9296326535572034396260765830437957449665559293039790192917313687184746663737362528663515710841598447"
+    "5099423164180365963266840241428022951909581791604068722200196731400725571180260079302965205104750105"
+    "7415427990944803343937787398753915124079657368163684106307704425918789766837558768208851417600966858"
+    "7840555619289728762382746112233327408521951923314984945135483536184436046065782465202497217185331511"
+    "80",
+    // ln(2)
+    "0.69314718055994530941723212145817656807550013436025525412068000949339362196969471560586332699641868"
+    "7542001481020570685733685520235758130557032670751635075961930727570828371435190307038623891673471123"
+    "3501153644979552391204751726815749320651555247341395258829504530070953263666426541042391578149520437"
+    "4043038550080194417064167151864471283996817178454695702627163106454615025720740248163777338963855069"
+    "5260668341137273873722928956493547025762652098859693201965058554764703306793654432547632744951250406"
+    "0694381471046899465062201677204245245296126879465461931651746813926725041038025462596568691441928716"
+    "0829380317271436778265487756648508567407764845146443994046142260319309673540257444607030809608504748"
+    "6638523138181676751438667476647890881437141985494231519973548803751658612753529166100071053558249879"
+    "4147295092931138971559982056543928717000721808576102523688921324497138932037843935308877482597017155"
+    "9107088236836275898425891853530243634214367061189236789192372314672321720534016492568727477823445353"
+    "4764811494186423867767744060695626573796008670762571991847340226514628379048830620330611446300737194"
+    "8900274364396500258093651944304119115060809487930678651588709006052034684297361938412896525565396860"
+    "2219412292420757432175748909770675268711581705113700915894266547859596489065305846025866838294002283"
+    "3005382074005677053046787001841624044188332327983863490015631218895606505531512721993983320307514084"
+    "2609147900126516824344389357247278820548627155274187724300248979454019618723398086083166481149093066"
+    "7519339312890431641370681397776498176974868903887789991296503619270710889264105230924783917373501229"
+    "8424204995689359922066022046549415106139187885744245577510206837030866619480896412186807790208181588"
+    "5800016881159730561866761991873952007667192145922367206025395954365416553112951759899400560003665135"
+    "6756905124592682574394648316833262490180382424082423145230614096380570070255138770268178516306902551"
+    "3703234053802145019015374029509942262995779647427138157363801729873940704242179972266962979939312706"
+    "9357472404933865308797587216996451294464918837711567016785988049818388967841349383140140731664727653"
+    "2763591923351123338933870951320905927218547132897547079789138444546667619270288553342342989932180376"
+    "9154973340267546758873236778342916191810430116091695265547859732891763545556742863877463987101912431"
+    "7542558883012067792102803412068797591430812833072303008834947057924965910058600123415617574132724659"
+    "4306843546521113502154434153995538185652275022142456644000627618330320647272572197515290827856842132"
+    "0795988638967277119552218819046603957009774706512619505278932296088931405625433442552392062030343941"
+    "7773579455921259019925591148440242390125542590031295370519220615064345837878730020354144217857580132"
+    "3645166070991438314500498589668857722214865288216941812704886075897220321666312837832915676307498729"
+    "8574638928269373509840778049395004933998762647550703162216139034845299424917248373406136622638349368"
+    "1116841670569252147513839306384553718626877973288955588716344297562447553923663694888778238901749810"
+    "2735655240505185477306194405242322125590248330827788888905962911972995457441562451248592683112607467"
+    "9728163809025000565599914612833254358111404848206064082422479240385576476235031100324259709142501114"
+    "6155848306700125831821915347207474111940098355732728261442738213970704779562596705790230338480617134"
+    "5555368553758106574973444792251119654616182789601006851296539547965866378352247362454609358503605067"
+    "8414391144523145778033591792112795570505555451438788818815351948593446724642949864050626518424475395"
+    "6637833734822075332944813064933603546101017746493267877167198612073968320123596077290246830459403130"
+    "5637763132401080420285435902694509403074001493395076731602850286973031871823998433525743549956085025"
+    "6608978339556421149480733936260751023818331411004708903950134330297413474840540615877539688838154076"
+    "9801776730369991074924697847843128430364112892028012272563468391623354787727340063958657179819069358"
+    "1273870343353131890503838456164444429279690638379690924413039656009876635846277660760534869749085938"
+    "1193930925179119885552776535666076243935687719423316664283820074481630786522923565982658627591874752"
+    "0875091447609016973569357231824249919475494431631463392270743244590302482544412490359409900711377326"
+    "3109980777239375790926677872262995677737591252687546917603955014736337374616450764577715981466107583"
+    "9930304323134949658648228467849524754029796890015109842434081672264105346517531889570934146265891398"
+    "0173123676248874585502699619246678052425882378995907144185753559519019313826275593500184826081076906"
+    "4940679244358858315035260170450093467140873847278951678454152522670236969054686984460721098217747366"
+    "0654752324208906381768833565330834542905202366217368168902181009185927011641625633710921091919381108"
+    "8408371995494139528087438476593315164645244837143495547071767478644667777773262400599442803883005052"
+    "0639602544872219401004824568355849141163720216501482904889541054859885821391467392801279607837657980"
+    "3019019789583129844584235055162804713845709836714317959849798338493664305135743977846408028394499649"
+    "28",
+    // ln(10)
+    "2.30258509299404568401799145468436420760110148862877297603332790096757260967735248023599720508959829"
+    "8341967784042286248633409525465082806756666287369098781689482907208325554680843799894826233198528393"
+    "5053089653777326288461633662222876982198867465436674744042432743651550489343149393914796194044002221"
+    "0510171417480036880840126470806855677432162283552201148046637156591213734507478569476834636167921018"
+    "0644507064800027750268491674655058685693567342067058113642922455440575892572420824131469568901675894"
+    "0256776311356919292033376587141660230105703089634572075440370847469940168269282808481184289314848524"
+    "9486448719278096762712757753970276686059524967166741834857044225071979650047149510504922147765676369"
+    "3866297697952211071826454973477266242570942932258279850258550978526538320760672631716430950599508780"
+    "7523710333101197857547331541421808427543863591778117054309827482385045648019095610299291824318237525"
+    "3577097505395651876975103749708886921802051893395072385392051446341972652872869651108625714921988499"
+    "7874887377134568620916705849807828059751193854445009978131146915934666241071846692310107598438319191"
+    "2922307925037472986509290098803919417026544168163357275557031515961135648465461908970428197633658369"
+    "8371632898217440736600916217785054177927636773114504178213766011101073104239783252189489881759792179"
+    "8666394319523936855916447118246753245630912528778330963604262982153040874560927760726641354787576616"
+    "2629265682987049579549139549180492090694385807900327630179415031178668620924085379498612649334793548"
+    "7173745167580953708828106745244010589244497647968607512027572418187498939597164310551884819528833074"
+    "6699317814634930000321200327765654130472621883970596794457943468343218395304414844803701305753674262"
+    "1536755798147704580314136377932362915601281853364984669422614652064599420729171193706024449293580370"
+    "0771898109736253322454836698850552828596619280509844717519850366668087497049698227322024482334309716"
+    "9111136813588418696549323714996941979687803008850408979618598756579894836445212043698216415292987811"
+    "7429733325886079159125109671875109292484750239305726654462762009230687915181358034777012955936462984"
+    "1236649702335517458619556477246185771736936840467657704787431978057385327181093388349633881306994556"
+    "9399346101090745616033312247949360455361849123333063704751724871276379140924398331810164737823379692"
+    "2656376820717069358463945316169494117018419381194054164494661112747128197058177832938417422314099300"
+    "2291150236219218672333726838568827353337192510341293070563254442661142976538830182238409102619858288"
+    "8433587455960453004548370789052578473166283701953392231047527564998119228742789713715713228319641003"
+    "4221242100821806795252766898581809561192083917607210809199234615169525990994737827806481280587927319"
+    "9389345341532018596971102140754228279629823706894176474064222575721245539252617937365243444056059533"
+    "6591539160312524480149313234572453879524389036839236450507881731359711238145323701508413491122324390"
+    "9276817247496079557991513639828810582857405380006533716555530141963322419180876210182049194926514838"
+    "9269229370789863527063850270226975512499430043818278847319921965814312197607111087634122446640737794"
+    "5558858391944080931102428308508474631906932198146864308355534765111465076909733339583257506827758283"
+    "1051803299481308483996817211366798801920377706868547950620358417219984374394106362343231481174552475"
+    "6400891921654912690827815060481711990701886292098228627167304771990157702853579105062846733722324000"
+    "1879561502289084396741468565648317688138920684095796918033543391364678657459054948802985438198807359"
+    "5542704154087340145317392545367328193997645602559843243305615873500293280257230645327034811810847231"
+    "1644680475191942641443755486576939292968342866758510673192419182285226899138931192169442423038517065"
+    "2933704512149838359794021827162913364025315495969131171466353442226456854468322628925319852739946666"
+    "9571860157929838504401537461528275128857545617541969976789089211724902376347878942402183376781397354"
+    "6583455562950793090466805159764095052481894758730994766129863206773565311117860615374810108158642772"
+    "1111350017666109114969649418307694630138841602650317848119297238020680868962365439659151206760790500"
+    "8319523024347817883038778471028263055912430624394315691194617233215130478320894258513052642518211479"
+    "8482584247309670795016443955200631371142485002497652901513103802164168434680366239650400578520317274"
+    "6463414888941277038831876066690417296597135990817736900634789459528897622199788079827139833181539554"
+    "1572978947016728750253235908278131635706663489567636634400113009800938783592130026295307123674302232"
+    "3997073379866841517182468881456576477211751163677973275051830749026653624060677896129313068549758743"
+    "3054853693766563031671111787156457115640249978305349228978026846460819213284031480482749893697037328"
+    "0933145401019276483406059371514185798933564159483238353253287520100855555015928089183326808993683275"
+    "1613743898197361257066796271617898201680857611037066082157532700013441457998839007709057790947693338"
+    "7185930557451637216392230278854688499219174775362013574000738080290034648012895050638568714967970278"
+    "24",
+    // 2/Pi
+    "0.63661977236758134307553505349005744813783858296182579499066937623558719053690614036045521106501234"
+    "3824291370907031832147571647384458314611511869642926799356916959867749636310292310985587701230754869"
+    "5715848695906467734495609668945160473295204568907990228637618475603476106958244819576437477513763421"
+    "1489239978577360099468939095783844359329238713229962466794585121879779460875152629914626785696415598"
+    "3496557394439935472396799849771502340684715433724470075068642186190147952038957841459037335072237209"
+    "9779865412213086271020128812991112655886640917869924783926633624240672121439925356479499953311466177"
+    "4111902028006496271025755539828524352048879750459072551105895156253227218583191392704524970925627984"
+    "3100098001191039428356227611187140526100840065270984083699246424962245824812585936356993836765740846"
+    "3016302248034861064272088686365630298983308903909851415995006213175632559270896374330191882933148761"
+    "6279990363063083139738815743593123486937025614675804665018282377331052507460010449087188461284503980"
+    "1754671780150502243345268467810390325128997664933372580424494147514252454546768668568278987840517002"
+    "3133442124784343780393582268748398189860417264952620703233577719198839980210175502645177835332273842"
+    "0314116606056416195719540255526431047879722936415599831476756239237495108824750172890875720546502104"
+    "4955121550155524427256270617363313114107733707198224283161544241410955984980503982997105188094376382"
+    "3372046593185647423108496230177978280871590791696379613091790808665984142612726141760153627594988707"
+    "6635505276386602785761910788275073462711241911918180141358303320752735475175106449925981223986232087"
+    "6334395004140508516172926321994878747511037862653848841368177634219914015170954777174146477511317149"
+    "4375137388129209485833516942284745453677178407327291678566600351323173254139911639898345971610698024"
+    "3957475637835322013481221522189249286323772790704129132525675923899928975334069742795939000415800273"
+    "5520159146894398432096010956043499819419151694273044559795613075989708333984459683315615107138972142"
+    "0182738243346859172338268933081419415702248083473572963982488470132735760838831742830998619952347442"
+    "6544387464786814989816841132487700738489933996464459826622415187870455972513198431043311196040313214"
+    "4009353091951634160955046229781723704047640217351993556186196849931806428291412020908840944070093252"
+    "6927190372442013126204374956545585812231704287203344718195068985839218959091697924368037485031476733"
+    "3158354513596174347466655902693780563801454930876697245552265532290369211038938024219285111214826135"
+    "1132128683950939866273963201307954026967165858734033126467413257344642923980599412479278935033776839"
+    "3666238166090025735772514577615355342460351908658006825882700750982423664348674314317569049390253268"
+    "4453199462376638756287940275497692023007679082276015287357024881354969414502723341662606918843524688"
+    "7183747330259540749998994834212466393224405568578178406459538110810045644280994086958980415466945615"
+    "4914403986995726942472482846961915597475546227692313940092228228576254554528094740804296402299436912"
+    "4462887872015912990381200667834088492138567509460174187058582626388760449233906839723883436513458667"
+    "6767107755165733262266026792528656608403582846914495370428271380704044538032027979073689427958499522"
+    "0631039238135883234190023901450625961375778168232715457427321680012603823789737570101794026996571634"
+    "5900576921328532982780465397827101575769614436217533421131697368813979374646058652914409910666641981"
+    "2562629374302120563633119523659146773739690950410539991319828072647857284932561903051589936331564696"
+    "3899130551596726799757949990860795927490665178407322158333100836945402741555691387298903989011320306"
+    "7427750334638891679297718989624655273245583322697739406771438953294957064960973800799123976160875845"
+    "3933709445470579965530861666425369931745496740244904434452847994533851388397673597709718236625133359"
+    "6192152847000464484666882076503172142117169645376124645364499812735437078339617753872313963895931235"
+    "4211881806122159656039547953635346193466088986744963490160561603647149684881809230133895890152597615"
+    "5367623473692463785290977356264500649572425132781295533568526138225526047008140434983823280449501743"
+    "9072621360749629577361453591215526884018126767318077951836706958167115169741104696289842375664109291"
+    "3151787277459651579885981373021089436663719228991994322450760293287537810717734018232078099702652248"
+    "1950646453746135968115018083422137657639620519309098186364725288931362046664626028393502297349181945"
+    "2481644868655236624246446629280003332244584247251213050347838064098528664554306459218879730831085265"
+    "7648063798404425313220830383339401220316382339931928746961159354205532958280832305590201716903939058"
+    "8284065707897538017236663458113441299734417418628950231664546529648183123987886265360886352218317725"
+    "3131120220984528355607496848436979564164020861987238845488301602284385362657254298175966390777431556"
+    "8317370247113208894804594569970095699491485252808706694430265823930904382966264093751497451652843899"
+    "4358860285229564162905741656718822889061919215260510383164960101378721928810469369196004081932249852"
+    "13",
+    // 2/sqrt(Pi)
+    "1.12837916709551257389615890312154517168810125865799771368817144342128493688298682897348732040421472"
+    "6886056695812723414703379862989652325732730979040035537986585675274119196879520704928700435945142423"
+    "1604915456404411090170543464332444169266162227990255269089720461364753818374903174932317026021327967"
+    "1554399875466832071559775233348815246607876043270120328724339247010091662506389375891331257665163104"
+    "3248869097731406379754861763556365896778950217001836917068443263565178670503666024049245124447449894"
+    "5400677948625285993188527008566089807266316078753919712163186756584411147658475764631584662115239295"
+    "5493650618034312361611904445923526493071808017068858972500578947843283623854861954845113975759155809"
+    "9749638273874479384145721266849535939897219177526087267452911757503086161868839476966576982758350723"
+    "7913270184826978506176607899308116821145082965496469503494840187939766833554297711783356674789971831"
+    "6330027537197737240879282581457385792761475465346223685735760423104973243794381779361506299024029491"
+    "0543518259630544244126468693514830520512369964555789973905060333899393713277246184408849722866262122"
+    "2034794086331088707292326005336217786095441082605496642867317294205837098981676775384953927481175082"
+    "0631694663415243390628978099463479622427705052578993316376214494461003461120014611101476053814047841"
+    "8650258730371308816054606091217117786637305172610517669441962183230451102680326896192154681258135304"
+    "1849554889158313198725738276213013947984423212700367624032696558905111760917943905598061845977122310"
+    "9125639488864463681897909645139784637869364073400641245842006487912585143705083809115767366267119261"
+    "1457760297346542852808312236531894105842976564219243112231755769151738741538633137951466072661211616"
+    "0853553108577744936791730762563835088920082338519646414020297595519747933104824024620417119451615483"
+    "2646487303937411587437399137328263274141492032934912465329570552658722511207346091629501935167385176"
+    "3550205032343583177087022638899559022604128931488470928339695796081675002149402705503760956452458569"
+    "3919364545520874270592713248783583970269245244060445116627896337948843125660857917839491661120658560"
+    "7523266214014936893615508670477608618650036418688655394351320917071629237858696600169504376712631226"
+    "9700601051262635023004805630507146960562075511746193744116099678233570896735643276617479233229464677"
+    "2267371612873826072465404584024191684103690800324425952044498410041827712415585369040902761841303820"
+    "9645742689302317751955293266991032855950554305801260918525332426420494824325238534530515166349789078"
+    "3280043012055166242868647524427377318531773354446540102614567355680535177054052252524092466096556675"
+    "4618691945020979504142212380450528625331705813141056491179290161108260714630500449021139869484902638"
+    "8054396964010035802102436730786700030173576668257067640788651978372917720364256206475638752270545283"
+    "7219505239146678435510613803649417614863894095412079053170504045514553464488107056711353135654973323"
+    "6105713636877906802896361286132938726893080149458374354478421389989052458651564368105546071376972806"
+    "3024665133985046940622055149866505806119488593528726325545980928717689417334445792789371920402173521"
+    "8061427209610327530090481359156114737900338999284739000941794126272521563323712393264365694015494798"
+    "8457581774610645426162206499660141760047415168470904121180062876948250658801710562509939193036384323"
+    "1415807593516056603078403064096750215816583845376652433516792834334923345507991167550163005034599207"
+    "8988504456804117989472244308381074316572268769747961810446103387750892355905894112628054330187188205"
+    "2323296211098231968445427138269209246722083034267315222596282846681360663935842591423730240672747239"
+    "1069451958821838947626437582946535196925437105103775159511869864690420960922415015203774076101229278"
+    "1485049685692772388692863900927531308051193212078854684333195974636954336983253935201227709130856853"
+    "3659284648929482462689198341410370816559026061991397315253654742669228807656294146054920514814442161"
+    "6737199497257342520530984041413841703575869808951830239688147519620430734088830933799319778545986819"
+    "1247415137417397877812432257644944649202976735756108226566923816174331738441849616773974526770131600"
+    "0611158033146504889386942017636220761974622355753354655623015052472394481598957781491749742189498834"
+    "7109193201871436903478924367909849155414898367706173075055122785642521239794747449912750631530948795"
+    "3307228293538793711496886230907581836120308194707679652633703008244493749493420643412988570741320558"
+    "4200235159844188803600675243335267515406353989768775392536757738598448543847830886442923147910697574"
+    "2551197747178793848709119681675248140968177614482124307752126689461714131793753833171338563018652562"
+    "8336840377627541992322575762381138828205336443002423982654181214609044146530225739526492944274443996"
+    "8726728378631080241539348703078315897251731951009005546992733111555384048456445259332841952287654090"
+    "5265039635343914700205568964751816544595017020701294552406121246333117051217933161573681420632282798"
+    "9287836601327598618574055689451020153094474536124886057862562643609148871032830026436030957753340581"
+    "95",
+    // Log2(e)
+    "1.44269504088896340735992468100189213742664595415298593413544940693110921918118507988552662289350634"
+    "4496997518309652544255593101687168359642720662158223479336274537369884718493630701387663532015533894"
+    "3189166648376431286154240474784222894979047950915303513385880549688658930969963680361105110756308441"
+    "4542721582834494189193390857771579004417128024684834137452269518236901123909403445996853990611342172"
+    "2886278029158010630061976762445652605995073753240625655815475938178305239725510724813077156267545807"
+    "5781713301935730061687619373729826758974156238179835671034434897506807055180884865613868329177321829"
+    "3491396843105934540220251863693452626921509559719100221967922432143342449417907145511849938592122167"
+    "5365311300774632767206461233741108211913794433398480579310912877609670200375758998158851806126788099"
+    "7609562525078410248470569007687680584613278654747820278086594620609107490153248199697305790152723247"
+    "8729874098125410003344868757382236471649454475370671675958994280998182678349013166663353480367898694"
+    "4688709116660497353729258607212948697354540708098306748938341237186314008359796188659758687452533054"
+    "6892129766415704206212592463136924216805908774083358139286665415849711625870695565785887476996312969"
+    "5250045937262738902680566935512872943383721913111665088100158786265591563795405590567782236814003096"
+    "8843934808622848184791345633141193023840264097274843644962195449224465222047176358607479658556660534"
+    "0982860985740278837433126885633544343069787018964358261391181002525990207661844329848831847239159127"
+    "0139045704773576483101021192829708532896093168035391964986957326439379149030848547061643378985634823"
+    "8900004564261855622496930913960312520223767376074153862116245551165086436799129389371225572752855358"
+    "5053886275469281675504073039189843896410520398990210789077410746707154871874459278264803257453294068"
+    "3655254410346573732031513822512936143762414220225071437036973073460941485010860318932360411331111574"
+    "4937702491468814553609722861672425272088889061517451052531559178316247029430178095934252371975125612"
+    "3295695059268589010755731214478327144386558395926203560074997084165676816792687219789830483022817829"
+    "7738515229379738119527839826692346781898272313835244277786564762313485990119402878073248417151105861"
+    "9349202546881837818357300094700147502951964817837874039354216278848238941974695520862627419471357392"
+    "5972266512394272011664626929387072840179569933988892025012779134593290946760204157648797908416074013"
+    "5915788971077369171628817269275518251796023247435017353260686373879376357204445831326435352650929006"
+    "1748888247033974920459020557724020364994277699238470527177685203357040125910731736639056137520453197"
+    "7787735627971806259213217436679842498743345623282289712472579456091975952150558351845236395313834976"
+    "5737626016698116768514614556063869556216263889632316027297109499506959280174435003079859392415750663"
+    "1512149867563008065061831442109254227561277967430907171276820183902280303065724252294800267075913436"
+    "7290806974477767992294539171408565610431486720206339126433847876327734955355690208319683083654998699"
+    "5836427314907981452178862584845139576611040381980502111375674381725171860026859128726437776332490397"
+    "3629633852363464853453173840906426836835666231946259994976397115999688210521685143972181120803362753"
+    "2777108775215648495741039853012962476717630471565859647928808793762483426744410719557003432627681818"
+    "9874161600509446764290101091342598114873699296078346271854255348493012197586031874731856964125596295"
+    "3587995973858821355995384741785595981341760463985344429527033939820883662829291277838449027147019204"
+    "9017146948931128789638977158205909605284340319092565302159258572975050434915773226067154970956780342"
+    "8559863290269859582459973729988518724548906065364271276955442472139591815440578352121207934436873637"
+    "2307557412386882432395351227013135052951958925168506223995164165891161002348879844727588061347294723"
+    "8116627759445068452346552631016399193215914909744435531615106845511355947492688983341998688576192612"
+    "0620049595996857740038071746977980582116085871348269821131934707521843514664367632888271978820749185"
+    "7524007463133613285208658460532800487276271988748891302822234197593587597783697265158305612590107412"
+    "0555138739400960168135787904601693632462444679162777830047512049804308438085695530290214878036949388"
+    "9578904127236636802628580950170487435489586629698700897620946029515092613710530981329077614868937642"
+    "1966654993625965623229718824113727696646704325736357204652741177314198331457888659890655949766869704"
+    "1971923568892983141661024249542919468779196736779502864308897038400115300395049779941139463781549157"
+    "5833214137204106846827369611007517740979802345789359742392323987378993140937256062637189570320468280"
+    "4512269710999646359650982544315626805399457654635377350716792966846077290818082063322372776485953402"
+    "2167177033408448028532828699620686878667707747800823199840964261036443241184541546822625563014803022"
+    "8790060701503247974987342058841876581107821551845714411643431499072184567481687648411886435318314869"
+    "3300269331688794801531470706533048809398937091231071592804965615791371810742359864832552926714722986"
+    "82",
+    // Log10(e)
+    "0.43429448190325182765112891891660508229439700580366656611445378316586464920887077472922494933843174"
+    "8318706106744766303733641679287158963906569221064662812265852127086568670329593370869658826688331163"
+    "6077384905142844348666768646586085135561482123487653435434357317253835622281395603048646652366095539"
+    "3773561763234319167109914115978949629935124579349263576554690776710824191504799109896749001032775376"
+    "5357027008732855095173144067469795189951359408804042393151886810840254465408979702986328682876262414"
+    "4013457043546132920600712605104028367125954846287707861998992326748439902348171535934551079475492552"
+    "4825778206792201409314681644673810305604756357204088833832094889965227174945413317914176402474075057"
+    "8876786097109925754773004604865604951561005798574134027267520143924791797085904793128521249334119732"
+    "9877226463885350226083881626316463883553685501768460295286399391633510647555704050513182342988874882"
+    "1206435950238189026433177115373822033626344164783971460018583960930063173339861340351357417871449714"
+    "5307649296833139239981060850573481616980928001619952352311723767656198922812701381580424871597834492"
+    "7215947562057179993483814031940166771520104787197582531617951490375597514246570736646439756863149325"
+    "1624987279948526374487911659592197017206627045592846570364626356757335757393696739945709096025263509"
+    "5719346883995123681135642801095877831375944271304998064379875041447209597487267406016065010537528700"
+    "0491167867133309154761441005054775930890767885596533432190763128353570304854020979941614010807910607"
+    "4988717524958414613038675320860013244863925455730728423861759706779893548445703183593365230160279716"
+    "2653572651442851986606376863533818195487638916134365237475946566392138073614450368379787682436902880"
+    "4493640496751871720614130731804417180216440993200651069696951247072666224570004229341407923361685302"
+    "4188602724118678062725703375525628707676966321736724547581333392638401303200385988999473322857034941"
+    "9583769147209060881244782507873671157303393156562515790709324537045074432662334980714303805958177695"
+    "7944070042202545430531910888982754062263600601879152267477788232096025228766762416332296812464502577"
+    "2950402266236275363117985321537808832723269207859809907574344373672487103558533065465816535351579439"
+    "9007032643622252001033698041984301552452417319052024721224111092732442530293020087103733750486749868"
+    "9117225672067268275246578790446735268575794059983346595878592624978725380185506389602375304294539963"
+    "7373674346807675152499862976767324049033631754881953236800876686486660692820823425363113049399727028"
+    "5887284908625845868704556924454853860720249739663112637212249753885496798158028481049472414045334119"
+    "2674240839673061167234256843129624666246259542760677182858963306586513950932049023032806357536242804"
+    "3154806583688522578329015307874831419859290741214153447721653982148476192884065713454387986078951994"
+    "3501153282645774231126681718328496869789090432442100527223347505314162598164645704453890114831376070"
+    "8445483457955728303866473638468537587172210685993933008378534367552699899185150879055911525282664002"
+    "8923479378811214078955551953744087722958662527367461956392806037427260186166896703120126631176969133"
+    "5570633163084957740635640622954449814140360207427875629666523754170311888898332695297945948121076084"
+    "8339634648644578297380492018939593886450713530024251256429146752636965688118790367526300650703432024"
+    "4236414540429427566811599887086707425742702488874660313561544827310090593117834824762746727919119303"
+    "1561408734851580960278885783246186554465476630734062551135495870831956466576742880730323169342673872"
+    "7205599774366566529764447395141032833942918472472974321114019358087391109026762802963420497065078011"
+    "8994338380080801328689093971724650294992876607216517809849554112310090571821788921130974078901715540"
+    "4264516983209027344452046303984882357014397800633233095488268617507044704961800134896837230164174043"
+    "7719913516171210181685548502811752314858971337587901923152484509079359066533916615589936769871036713"
+    "7632686895638912734951751616317964532253803198324283539709706239802845447138572770324276923383878730"
+    "4131263652522112610609306075299203064509684416971146563807471998586426487864455519368131349399776807"
+    "5370028036024119728783045170876588640557274222898045184194495971154337684449500375878822631988769253"
+    "2085366911255092252181873123932771900493820973784978727831405320344112594694021024951267664085270008"
+    "2407854919101565461350576305177715502458085207399099672394698796835821040678125015778927092104676444"
+    "8617822017096378924405984125146522842779108272140383674135124864245915091815340922639427082875668985"
+    "6983568226776285249581964549930617138567770060022385539579116020324803366127020550158634756468389241"
+    "2459211205592932440572609937191288065565122646432875882207422524703779508660290877683311980684051139"
+    "9446881155342324981337347844120983456946922255832231935667026543657151456765841719852590093095753594"
+    "6537003976285527390467859085207519766305455378559967815843428208490356832939750380813245359673787090"
+    "5261910286308097941299587972686206143775978702731246056224813099935900046049185581537175522966037583"
+    "81",
+    // sqrt(2)
+    "1.41421356237309504880168872420969807856967187537694807317667973799073247846210703885038753432764157"
+    "2735013846230912297024924836055850737212644121497099935831413222665927505592755799950501152782060571"
+    "4701095599716059702745345968620147285174186408891986095523292304843087143214508397626036279952514079"
+    "8968725339654633180882964062061525835239505474575028775996172983557522033753185701135437460340849884"
+    "7160386899970699004815030544027790316454247823068492936918621580578463111596668713013015618568987237"
+    "2352885092648612494977154218334204285686060146824720771435854874155657069677653720226485447015858801"
+    "6207584749226572260020855844665214583988939443709265918003113882464681570826301005948587040031864803"
+    "4219489727829064104507263688131373985525611732204024509122770022694112757362728049573810896750401836"
+    "9868368450725799364729060762996941380475654823728997180326802474420629269124859052181004459842150591"
+    "1202494413417285314781058036033710773091828693147101711116839165817268894197587165821521282295184884"
+    "7208969463386289156288276595263514054226765323969461751129160240871551013515045538128756005263146801"
+    "7127402653969470240300517495318862925631385188163478001569369176881852378684052287837629389214300655"
+    "8695686859645951555016447245098368960368873231143894155766510408839142923381132060524336294853170499"
+    "1577175622854974143899918802176243096520656421182731672625753959471725593463723863226148274262220867"
+    "1155839599926521176252698917540988159348640083457085181472231814204070426509056532333398436457865796"
+    "7965192672923998753666172159825788602633636178274959942194037777536814262177387991945513972312740668"
+    "9832998989538672882285637869774966251996658352577619893932284534473569479496295216889148549253890475"
+    "5828834526096524096542889394538646625744927556381964410316979833061852019379384940057156333720548068"
+    "5405758679996701213722394758214263065851322174088323829472876173936474678374319600015921888073478576"
+    "1725221186749042497736692920731109636972160893370866115673458533483329525467585164471075784860246360"
+    "0834449114818587655554286455123314219926311332517970608436559704352856410087918500760361009159465670"
+    "6768836055717400767569050961367194013249356052401859991050621081635977264313806054670102935699710424"
+    "2510578174953105725593498445112692278034491350663756874776028316282960553242242695753452902883876844"
+    "6429173282770888318087025339852338122749990812371892540726475367850304821591801886167108972869229201"
+    "1975998807038185433325364602110822992792930728717807998880991767417741089830608003263118164279882311"
+    "7154363869661702999934161614878686018045505553986913115186010386375325004558186044804075024119518430"
+    "5674533683613674597374423988553285179308960373898915173195874134428817842125021916951875593444387396"
+    "1893145499999061075870490902608835176362247497578588583680374579311573398020999866221869499225959132"
+    "7642361941059210032802614987456659968887406795616739185957288864247346358588686449682238600698335264"
+    "2799056283165613913942557649062065186021647263033362975075697870606606856498160092718709292153132368"
+    "2813569889370974165044745909605374727965244770940992412387106144705439867436473384774548191008728862"
+    "2214958952959118789214917983398108378827815306556231581036064867587303601450227320882935134138722768"
+    "4176678436905294286984908384557445794095986260742499549168028530773989382960362133539875320509199893"
+    "6075139064444957684569934712763645071632791547015977335486389394232572775400382602747856741725809514"
+    "1630715959784981800944356037939098559016827215403458158152100493666295344882710729239660232163823826"
+    "6612626830502572781169451035379371568823365932297823192986064679789864092085609558142614363631004615"
+    "5943325504744939759339991254195323009321753044765339647066276116617535187546462096763455873861648801"
+    "9884849747926404506544489691004079421181692579685756378488149898641685499491635761448404702103398921"
+    "5342377037233353115645944389703653166721949049351882905806307401346862641672470110653463493916407146"
+    "2855679801779338144240452691370666097776387848662380033923243704741153318725319060191659964553811578"
+    "8841380843323210533767461812178014296092832411362752540887372905129407339479433061943956936702079429"
+    "5158782283493219316664111301549594698378977674344435393377099571349884078908508158923660700886581054"
+    "7094979046572298888089246128281601313370102908029099974564784958154561464871551639050241985790613109"
+    "3458783306200262207372471676685455499904994085710809925759928893236615438271955005781625133038153146"
+    "5779079268685008069844284791524242754410268057563215653220618857512251130639370253629271619682512591"
+    "9202521605870118959673224423926742373449076464672737534796459881914980793171800242385545388603836831"
+    "0800779182466462754117444250018727779518164383451463461299020763343017968554385631667723518389336667"
+    "0422221109391449302879638128398893117313084300421255501854985065294556377660314612559091046113847682"
+    "8235959247722862904264273616326458544339287726386034314980489639736332975488592568114929683612672589"
+    "8573833216436663487023477302610106130507298611534129948808774473111229542652751653665911730142360626"
+    "52",
+    // 1/sqrt(2)
+    "0.70710678118654752440084436210484903928483593768847403658833986899536623923105351942519376716382078"
+    "6367506923115456148512462418027925368606322060748549967915706611332963752796377899975250576391030285"
+    "7350547799858029851372672984310073642587093204445993047761646152421543571607254198813018139976257039"
+    "9484362669827316590441482031030762917619752737287514387998086491778761016876592850567718730170424942"
+    "3580193449985349502407515272013895158227123911534246468459310790289231555798334356506507809284493618"
+    "6176442546324306247488577109167102142843030073412360385717927437077828534838826860113242723507929400"
+    "8103792374613286130010427922332607291994469721854632959001556941232340785413150502974293520015932401"
+    "7109744863914532052253631844065686992762805866102012254561385011347056378681364024786905448375200918"
+    "4934184225362899682364530381498470690237827411864498590163401237210314634562429526090502229921075295"
+    "5601247206708642657390529018016855386545914346573550855558419582908634447098793582910760641147592442"
+    "3604484731693144578144138297631757027113382661984730875564580120435775506757522769064378002631573400"
+    "8563701326984735120150258747659431462815692594081739000784684588440926189342026143918814694607150327"
+    "9347843429822975777508223622549184480184436615571947077883255204419571461690566030262168147426585249"
+    "5788587811427487071949959401088121548260328210591365836312876979735862796731861931613074137131110433"
+    "5577919799963260588126349458770494079674320041728542590736115907102035213254528266166699218228932898"
+    "3982596336461999376833086079912894301316818089137479971097018888768407131088693995972756986156370334"
+    "4916499494769336441142818934887483125998329176288809946966142267236784739748147608444574274626945237"
+    "7914417263048262048271444697269323312872463778190982205158489916530926009689692470028578166860274034"
+    "2702879339998350606861197379107131532925661087044161914736438086968237339187159800007960944036739288"
+    "0862610593374521248868346460365554818486080446685433057836729266741664762733792582235537892430123180"
+    "0417224557409293827777143227561657109963155666258985304218279852176428205043959250380180504579732835"
+    "3384418027858700383784525480683597006624678026200929995525310540817988632156903027335051467849855212"
+    "1255289087476552862796749222556346139017245675331878437388014158141480276621121347876726451441938422"
+    "3214586641385444159043512669926169061374995406185946270363237683925152410795900943083554486434614600"
+    "5987999403519092716662682301055411496396465364358903999440495883708870544915304001631559082139941155"
+    "8577181934830851499967080807439343009022752776993456557593005193187662502279093022402037512059759215"
+    "2837266841806837298687211994276642589654480186949457586597937067214408921062510958475937796722193698"
+    "0946572749999530537935245451304417588181123748789294291840187289655786699010499933110934749612979566"
+    "3821180970529605016401307493728329984443703397808369592978644432123673179294343224841119300349167632"
+    "1399528141582806956971278824531032593010823631516681487537848935303303428249080046359354646076566184"
+    "1406784944685487082522372954802687363982622385470496206193553072352719933718236692387274095504364431"
+    "1107479476479559394607458991699054189413907653278115790518032433793651800725113660441467567069361384"
+    "2088339218452647143492454192278722897047993130371249774584014265386994691480181066769937660254599946"
+    "8037569532222478842284967356381822535816395773507988667743194697116286387700191301373928370862904757"
+    "0815357979892490900472178018969549279508413607701729079076050246833147672441355364619830116081911913"
+    "3306313415251286390584725517689685784411682966148911596493032339894932046042804779071307181815502307"
+    "7971662752372469879669995627097661504660876522382669823533138058308767593773231048381727936930824400"
+    "9942424873963202253272244845502039710590846289842878189244074949320842749745817880724202351051699460"
+    "7671188518616676557822972194851826583360974524675941452903153700673431320836235055326731746958203573"
+    "1427839900889669072120226345685333048888193924331190016961621852370576659362659530095829982276905789"
+    "4420690421661605266883730906089007148046416205681376270443686452564703669739716530971978468351039714"
+    "7579391141746609658332055650774797349189488837172217696688549785674942039454254079461830350443290527"
+    "3547489523286149444044623064140800656685051454014549987282392479077280732435775819525120992895306554"
+    "6729391653100131103686235838342727749952497042855404962879964446618307719135977502890812566519076573"
+    "2889539634342504034922142395762121377205134028781607826610309428756125565319685126814635809841256295"
+    "9601260802935059479836612211963371186724538232336368767398229940957490396585900121192772694301918415"
+    "5400389591233231377058722125009363889759082191725731730649510381671508984277192815833861759194668333"
+    "5211110554695724651439819064199446558656542150210627750927492532647278188830157306279545523056923841"
+    "4117979623861431452132136808163229272169643863193017157490244819868166487744296284057464841806336294"
+    "9286916608218331743511738651305053065253649305767064974404387236555614771326375826832955865071180313"
+    "26",
+};
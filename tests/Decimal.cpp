@@ -1,4 +1,7 @@
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <sstream>
 #include <string>
 #include <string.h>
@@ -357,4 +360,656 @@ BOOST_AUTO_TEST_CASE(Arithmetic) {
             "86844066927987146567678238756515930889628173209306178286953872356138621120753"_D);
 }
 
+BOOST_AUTO_TEST_CASE(DivMod) {
+    Decimal q, r;
+    q = xFD::DivMod(17_D, 5_D, r);
+    BOOST_CHECK_EQUAL(q.ToFixedString(), "+3");
+    BOOST_CHECK_EQUAL(r.ToFixedString(), "+2");
+
+    q = xFD::DivMod(-17_D, 5_D, r);
+    BOOST_CHECK_EQUAL(q.ToFixedString(), "-3");
+    BOOST_CHECK_EQUAL(r.ToFixedString(), "-2");
+
+    q = xFD::DivMod(17_D, -5_D, r);
+    BOOST_CHECK_EQUAL(q.ToFixedString(), "-3");
+    BOOST_CHECK_EQUAL(r.ToFixedString(), "+2");
+
+    q = xFD::DivMod(3_D, 5_D, r);
+    BOOST_CHECK_EQUAL(q.ToFixedString(), "+0");
+    BOOST_CHECK_EQUAL(r.ToFixedString(), "+3");
+
+    Decimal a = "86844066927987146567678238756515930889628173209306178286953872356138621120753"_D;
+    Decimal b = "458479643868196418248935325987194"_D;
+    q = xFD::DivMod(a, b, r);
+    BOOST_CHECK_EQUAL(q*b + r, a);
+    BOOST_CHECK_EQUAL(r, a % b);
+    BOOST_CHECK_EQUAL(r, xFD::Mod(a, b));
+
+    BOOST_CHECK_THROW(xFD::DivMod(a, 0_D, r), DecimalIllegalOperation);
+    BOOST_CHECK_THROW(xFD::DivMod(11.5_D, 2_D, r), DecimalIllegalOperation);
+}
+
+BOOST_AUTO_TEST_CASE(Sqrt) {
+    BOOST_CHECK_EQUAL(xFD::Sqrt(2_D).ToFixedString(),
+            "+1.4142135623730950488016887242096980785696");
+    BOOST_CHECK_EQUAL(xFD::RSqrt(2_D).ToFixedString(),
+            "+0.7071067811865475244008443621048490392848");
+    BOOST_CHECK_EQUAL(xFD::Sqrt("0.0004"_D).ToFixedString(), "+0.02");
+    BOOST_CHECK_EQUAL(xFD::Hypot(3_D, 4_D).ToFixedString(), "+5");
+
+    Decimal a = "123456789012345678901234567890123456789"_D;
+    BOOST_CHECK_EQUAL(xFD::ISqrt(a).ToFixedString(), "+11111111061111110993");
+    BOOST_CHECK_EQUAL(xFD::ISqrt(a*a), a);
+    BOOST_CHECK_EQUAL(xFD::IsSquare(a*a), true);
+    BOOST_CHECK_EQUAL(xFD::IsSquare(a*a + 1_D), false);
+
+    BOOST_CHECK_THROW(xFD::Sqrt(-1_D), DecimalIllegalOperation);
+    BOOST_CHECK_THROW(xFD::ISqrt(2.5_D), DecimalIllegalOperation);
+}
+
+BOOST_AUTO_TEST_CASE(MulTrunc) {
+    Decimal a("3.14159265358979323846"_D);
+    Decimal b("2.71828182845904523536"_D);
+
+    BOOST_CHECK_EQUAL(xFD::MulTrunc(a, b, 10).ToString(), "8.539734222");
+    BOOST_CHECK_EQUAL(xFD::MulTrunc(a, b, 100), a*b);
+    BOOST_CHECK_EQUAL(xFD::MulTrunc(123_D, 456_D, 3).ToString(), "56000");
+    BOOST_CHECK_EQUAL(xFD::MulTrunc(-a, b, 5).ToString(), "-8.5397");
+}
+
+BOOST_AUTO_TEST_CASE(SeriesRecurrences) {
+    // Each term follows from the previous one, so a wrong step shows up
+    // well before the last place once enough terms are taken.
+    DecimalIterations its;
+    its.trig = 30;
+    BOOST_CHECK_EQUAL(xFD::Round(xFD::Sin(1_D(its)), -15).ToString(), "0.841470984807897");
+    BOOST_CHECK_EQUAL(xFD::Round(xFD::Cos(1_D(its)), -15).ToString(), "0.54030230586814");
+    its.trig = 40;
+    BOOST_CHECK_EQUAL(xFD::Round(xFD::Erf("0.5"_D(its)), -15).ToString(), "0.520499877813047");
+    BOOST_CHECK_EQUAL(xFD::Round(xFD::Asin("0.5"_D(its)), -15).ToString(), "0.523598775598299");
+    BOOST_CHECK_EQUAL(xFD::Round(xFD::Atan(4_D(its)), -15).ToString(), "1.325817663668032");
+    BOOST_CHECK_EQUAL(xFD::Round(xFD::Atan(-4_D(its)), -15).ToString(), "-1.325817663668032");
+}
+
+BOOST_AUTO_TEST_CASE(Hyperbolic) {
+    BOOST_CHECK_EQUAL(SeqBernoulli::Term(2_D).ToString(), "0.1666666666666666666666666666666666666667");
+    BOOST_CHECK_EQUAL(SeqBernoulli::Term(4_D).ToString(), "-0.0333333333333333333333333333333333333333");
+    BOOST_CHECK_EQUAL(SeqBernoulli::Term(6_D).ToString(), "0.0238095238095238095238095238095238095238");
+    BOOST_CHECK_EQUAL(SeqBernoulli::Term(20_D).ToString(), "-529.1242424242424242424242424242424242424242");
+    BOOST_CHECK_EQUAL(SeqBernoulli::Term(7_D), 0_D);
+
+    // Past the hardware and double-double tiers, at the default 40 decimals.
+    BOOST_CHECK_EQUAL(xFD::Tanh("0.5"_D).ToString(), "0.4621171572600097585023184836436725487303");
+    BOOST_CHECK_EQUAL(xFD::Tanh("-3"_D).ToString(), "-0.9950547536867304513318801852554884750978");
+    BOOST_CHECK_EQUAL(xFD::Pow("1.21423"_D).ToString(), "3.3676999367593623344744380347388667711514");
+    BOOST_CHECK_EQUAL(xFD::Pow("-3.25"_D).ToString(), "0.0387742078317220098868998352675961432601");
+}
+
+BOOST_AUTO_TEST_CASE(Rounding) {
+    BOOST_CHECK_EQUAL(xFD::Round("2.5"_D, 0, xFD::ROUND_HALF_EVEN).ToString(), "2");
+    BOOST_CHECK_EQUAL(xFD::Round("3.5"_D, 0, xFD::ROUND_HALF_EVEN).ToString(), "4");
+    BOOST_CHECK_EQUAL(xFD::Round("2.51"_D, 0, xFD::ROUND_HALF_EVEN).ToString(), "3");
+    BOOST_CHECK_EQUAL(xFD::Round("-2.5"_D).ToString(), "-3");
+    BOOST_CHECK_EQUAL(xFD::Round("9.96"_D, -1).ToString(), "10");
+    BOOST_CHECK_EQUAL(xFD::Round("1.2345"_D, -3, xFD::ROUND_DOWN).ToString(), "1.234");
+    BOOST_CHECK_EQUAL(xFD::Round("1.2341"_D, -3, xFD::ROUND_UP).ToString(), "1.235");
+    BOOST_CHECK_EQUAL(xFD::Round(1234_D, 2).ToString(), "1200");
+    BOOST_CHECK_EQUAL(xFD::Round("-0.4"_D), 0_D);
+
+    BOOST_CHECK_EQUAL(xFD::Floor("2.7"_D), 2_D);
+    BOOST_CHECK_EQUAL(xFD::Floor("-2.5"_D), -3_D);
+    BOOST_CHECK_EQUAL(xFD::Ceil("-2.5"_D), -2_D);
+    BOOST_CHECK_EQUAL(xFD::Ceil(3_D), 3_D);
+
+    Decimal d("1.23456"_D);
+    d.SetPrecision(3);
+    BOOST_CHECK_EQUAL(d.ToFixedString(), "+1.235");
+    d.SetPrecision(5);
+    BOOST_CHECK_EQUAL(d.ToFixedString(), "+1.23500");
+
+    Decimal ipart;
+    Decimal frac = xFD::Modf("-12.375"_D, ipart);
+    BOOST_CHECK_EQUAL(ipart, -12_D);
+    BOOST_CHECK_EQUAL(frac, -"0.375"_D);
+}
+
+BOOST_AUTO_TEST_CASE(Fma) {
+    BOOST_CHECK_EQUAL(xFD::Fma("1.25"_D, "3.5"_D, "0.125"_D), "4.5"_D);
+    BOOST_CHECK_EQUAL(xFD::Fma("1.25"_D, -"3.5"_D, "0.125"_D), -"4.25"_D);
+    BOOST_CHECK_EQUAL(xFD::Fma(2_D, 3_D, -6_D), 0_D);
+    BOOST_CHECK_EQUAL(xFD::Fma(-7_D, "0.000001"_D, -3_D), -"3.000007"_D);
+
+    // Only the final sum is rounded to the working precision.
+    Decimal a("0.123456789012345678901234567890123456789"_D);
+    BOOST_CHECK_EQUAL(xFD::Fma(a, a, 0_D).ToString(), "0.015241578753238836750495351562566681945");
+    Decimal b("1.00000000000000000000001"_D);
+    BOOST_CHECK_EQUAL(xFD::Fma(b, b, -1_D), "0.00000000000000000000002"_D);
+}
+
+BOOST_AUTO_TEST_CASE(Modulus) {
+    DecimalModulus M("1000000007"_D);
+    BOOST_CHECK_EQUAL(M.Reduce("123456789123456789"_D), 259259273_D);
+    BOOST_CHECK_EQUAL(M.Reduce("99999999999999999999999999999999"_D), 965700006_D);
+    BOOST_CHECK_EQUAL(M.Reduce(-5_D), 1000000002_D);
+    BOOST_CHECK_EQUAL(M.MulMod(999999999_D, 888888888_D), 888888952_D);
+    BOOST_CHECK_EQUAL(M.AddMod(1000000006_D, 5_D), 4_D);
+
+    Decimal x("416984806968863648079"_D);
+    DecimalModulus M16(16_D);
+    BOOST_CHECK_EQUAL(M16.Reduce(x), x % 16_D);
+
+    BOOST_CHECK_THROW(DecimalModulus(0_D), DecimalIllegalOperation);
+    BOOST_CHECK_THROW(DecimalModulus("2.5"_D), DecimalIllegalOperation);
+    BOOST_CHECK_THROW(M.Reduce("1.5"_D), DecimalIllegalOperation);
+}
+
+BOOST_AUTO_TEST_CASE(PowMod) {
+    BOOST_CHECK_EQUAL(xFD::IPow(2_D, 100_D), "1267650600228229401496703205376"_D);
+    BOOST_CHECK_EQUAL(xFD::IPow("1.5"_D, 7_D), "17.0859375"_D);
+    BOOST_CHECK_EQUAL(xFD::IPow(-3_D, 5_D), -243_D);
+    BOOST_CHECK_EQUAL(xFD::IPow(7_D, 0_D), 1_D);
+    BOOST_CHECK_EQUAL(xFD::IPow(2_D, -3_D), "0.125"_D);
+
+    BOOST_CHECK_EQUAL(xFD::PowMod(4_D, 13_D, 497_D), 445_D);
+    BOOST_CHECK_EQUAL(xFD::PowMod(2_D, 1000000_D, 1000000007_D), 235042059_D);
+    BOOST_CHECK_EQUAL(xFD::PowMod(5_D, 0_D, 1_D), 0_D);
+    // Fermat: a^(p-1) = 1 mod p
+    Decimal p("170141183460469231731687303715884105727"_D);
+    BOOST_CHECK_EQUAL(xFD::PowMod(3_D, p - 1_D, p), 1_D);
+
+    BOOST_CHECK_EQUAL(xFD::Pow("1.1"_D, 3_D), "1.331"_D);
+    BOOST_CHECK_EQUAL(xFD::Pow(-2_D, 3_D), -8_D);
+    BOOST_CHECK_EQUAL(xFD::Pow(4_D, -2_D), "0.0625"_D);
+    BOOST_CHECK_EQUAL(3_D ^ 4_D, 81_D);
+
+    BOOST_CHECK_THROW(xFD::PowMod(2_D, -1_D, 7_D), DecimalIllegalOperation);
+    BOOST_CHECK_THROW(xFD::IPow(2_D, "0.5"_D), DecimalIllegalOperation);
+}
+
+BOOST_AUTO_TEST_CASE(Integer) {
+    xFDInt a("123456789012345678901234567890"_D), b(-987654321LL);
+    BOOST_CHECK_EQUAL((a + b).ToDecimal(), "123456789012345678900246913569"_D);
+    BOOST_CHECK_EQUAL((a - b).ToDecimal(), "123456789012345678902222222211"_D);
+    BOOST_CHECK_EQUAL((a * b).ToDecimal(), -"121932631124828532112482853211126352690"_D);
+    BOOST_CHECK_EQUAL((a / b).ToDecimal(), -"124999998873437499901"_D);
+    BOOST_CHECK_EQUAL((a % b).ToDecimal(), 574845669_D);
+    BOOST_CHECK(b < a);
+    BOOST_CHECK((a - a).IsZero());
+
+    xFDInt c(1000LL);
+    BOOST_CHECK_EQUAL(c.DivSmall(16), 8u);
+    BOOST_CHECK_EQUAL(c.MulAdd(16, 8).ToDecimal(), 1000_D);
+    BOOST_CHECK_EQUAL(xFDInt("5.000"_D).ToDecimal(), 5_D);
+    BOOST_CHECK_THROW(xFDInt("1.5"_D), DecimalIllegalOperation);
+
+    BOOST_CHECK_EQUAL(xFD::Factorial(0_D), 1_D);
+    BOOST_CHECK_EQUAL(xFD::Factorial(5_D), 120_D);
+    BOOST_CHECK_EQUAL(xFD::Factorial(30_D), "265252859812191058636308480000000"_D);
+    BOOST_CHECK_EQUAL(xFD::nCr(50_D, 25_D), 126410606437752_D);
+    BOOST_CHECK_EQUAL(xFD::nCr(5_D, 6_D), 0_D);
+    BOOST_CHECK_EQUAL(xFD::nPr(5_D, 2_D), 20_D);
+    BOOST_CHECK_EQUAL(xFD::Binomial(2_D, 3_D, 4_D), 625_D);
+    BOOST_CHECK_EQUAL(Decimal::FromHex("-ff"), -255_D);
+}
+
+#ifdef __SIZEOF_INT128__
+BOOST_AUTO_TEST_CASE(Int128) {
+    // Operands below 38 digits take the native path, larger ones the
+    // digit kernels; both must agree.
+    Decimal a("12345678901234567.8901"_D), b("-0.000123"_D);
+    BOOST_CHECK_EQUAL((a + b).ToFixedString(), "+12345678901234567.889977");
+    BOOST_CHECK_EQUAL((b - a).ToFixedString(), "-12345678901234567.890223");
+    BOOST_CHECK_EQUAL((a * b).ToFixedString(), "-1518518504851.8518504823");
+    Decimal big("99999999999999999999999999999999999999"_D);
+    BOOST_CHECK_EQUAL((big + 1_D).ToFixedString(), "+100000000000000000000000000000000000000");
+    BOOST_CHECK_EQUAL((big * big + 1_D) % 10_D, 2_D);
+    BOOST_CHECK_EQUAL((a - a).ToFixedString(), "+0");
+
+    // Quotients are rounded exactly to the working precision.
+    BOOST_CHECK_EQUAL((22_D / 7_D).ToString(), "3.1428571428571428571428571428571428571429");
+    BOOST_CHECK_EQUAL(("0.5"_D / 8_D).ToString(), "0.0625");
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(Hardware) {
+    // Up to 15 decimals these come from long double, correctly rounded.
+    DecimalIterations its;
+    its.decimals = 10;
+    BOOST_CHECK_EQUAL(xFD::Sin(1_D(its)).ToString(), "0.8414709848");
+    BOOST_CHECK_EQUAL(xFD::Cos(1_D(its)).ToString(), "0.5403023059");
+    BOOST_CHECK_EQUAL(xFD::Ln(2_D(its)).ToString(), "0.6931471806");
+    BOOST_CHECK_EQUAL(xFD::Pow(1_D(its)).ToString(), "2.7182818285");
+    BOOST_CHECK_EQUAL(xFD::Pow("-2.5"_D(its)).ToString(), "0.0820849986");
+
+    its.decimals = 15;
+    BOOST_CHECK_EQUAL(xFD::Erf("0.5"_D(its)).ToString(), "0.520499877813047");
+    BOOST_CHECK_EQUAL(xFD::Pow(2_D(its), "0.5"_D(its)).ToString(), "1.414213562373095");
+    BOOST_CHECK_EQUAL(xFD::Atan2(1_D(its), 1_D(its)).ToString(), "0.785398163397448");
+    BOOST_CHECK_EQUAL(xFD::Atan2(-1_D(its), -1_D(its)).ToString(), "3.926990816987242");
+    // Past the hardware tier the third quadrant moves up by 2*Pi.
+    DecimalIterations wide;
+    wide.decimals = 20;
+    BOOST_CHECK_EQUAL(xFD::Atan2(-1_D(wide), "-0.001"_D(wide)).ToString().substr(0, 20), "3.142592653256460105");
+
+    // Both sides of the cutoff give the same digits.
+    BOOST_CHECK_EQUAL(xFD::Pow("1.21423"_D(its)).ToString(), "3.367699936759362");
+    BOOST_CHECK_EQUAL(xFD::Ln(10_D(its)).ToString(), "2.302585092994046");
+    its.decimals = 16;
+    BOOST_CHECK_EQUAL(xFD::Pow("1.21423"_D(its)).ToString(), "3.3676999367593623");
+    BOOST_CHECK_EQUAL(xFD::Ln(10_D(its)).ToString(), "2.3025850929940457");
+    BOOST_CHECK_EQUAL(xFD::Pow(2_D(its), "0.5"_D(its)).ToString(), "1.414213562373095");
+
+    // Too close to a rounding boundary for long double, so the value
+    // comes from a slower tier.
+    its.decimals = 10;
+    BOOST_CHECK_EQUAL(xFD::Pow("12.0518"_D(its)).ToString(), "171407.6642973597");
+
+    // Exact results are always rejected when truncating, so these run the
+    // series even at 10 and 25 decimals.
+    its.trunc_not_round = true;
+    BOOST_CHECK_EQUAL(xFD::Pow(0_D(its)), 1_D);
+    BOOST_CHECK_EQUAL(xFD::Ln(1_D(its)), 0_D);
+    BOOST_CHECK_EQUAL(xFD::Pow(1_D(its)).ToString(), "2.7182818284");
+    its.decimals = 25;
+    BOOST_CHECK_EQUAL(xFD::Pow(0_D(its)), 1_D);
+    BOOST_CHECK_EQUAL(xFD::Pow(1_D(its)).ToString(), "2.7182818284590452353602874");
+}
+
+BOOST_AUTO_TEST_CASE(DoubleDouble) {
+    // Between 16 and 30 decimals a double-double evaluation is used when
+    // its error bound cannot change the rounded result.
+    DecimalIterations its;
+    its.decimals = 25;
+    BOOST_CHECK_EQUAL(xFD::Sin(1_D(its)).ToString(), "0.8414709848078965066525023");
+    BOOST_CHECK_EQUAL(xFD::Sin(100_D(its)).ToString(), "-0.5063656411097587936565576");
+    BOOST_CHECK_EQUAL(xFD::Cos("0.5"_D(its)).ToString(), "0.8775825618903727161162816");
+    BOOST_CHECK_EQUAL(xFD::Ln(2_D(its)).ToString(), "0.6931471805599453094172321");
+    BOOST_CHECK_EQUAL(xFD::Pow("-3.25"_D(its)).ToString(), "0.0387742078317220098868998");
+
+    its.decimals = 20;
+    BOOST_CHECK_EQUAL(xFD::Pow(1_D(its)).ToString(), "2.71828182845904523536");
+    BOOST_CHECK_EQUAL(xFD::Pow(2_D(its), "0.5"_D(its)).ToString(), "1.4142135623730950488");
+
+    // Both sides of the cutoff give the same digits.
+    its.decimals = 30;
+    BOOST_CHECK_EQUAL(xFD::Pow("1.21423"_D(its)).ToString(), "3.367699936759362334474438034739");
+    BOOST_CHECK_EQUAL(xFD::Ln(10_D(its)).ToString(), "2.302585092994045684017991454684");
+    BOOST_CHECK_EQUAL(xFD::Pow(2_D(its), "0.5"_D(its)).ToString(), "1.41421356237309504880168872421");
+    its.decimals = 31;
+    BOOST_CHECK_EQUAL(xFD::Pow("1.21423"_D(its)).ToString(), "3.3676999367593623344744380347389");
+    BOOST_CHECK_EQUAL(xFD::Ln(10_D(its)).ToString(), "2.3025850929940456840179914546844");
+    BOOST_CHECK_EQUAL(xFD::Pow(2_D(its), "0.5"_D(its)).ToString(), "1.4142135623730950488016887242097");
+}
+
+BOOST_AUTO_TEST_CASE(Tuning) {
+    // The crossovers change the algorithm, never the result.
+    std::string a, b;
+    for (int i = 0; i < 300; i++) {
+        a += static_cast<char>('1' + (i * 7) % 9);
+        b += static_cast<char>('0' + (i * 13) % 10);
+    }
+    Decimal x(a), y(b), z = x*x + y;
+
+    DecimalTuning saved = xFD::Tuning();
+    xFD::Tuning().karatsuba = INT_MAX;
+    xFD::Tuning().newton_div = INT_MAX;
+    Decimal p1 = x*y, s1 = x*x, r1, q1 = xFD::DivMod(z, y, r1);
+
+    xFD::Tuning().karatsuba = 4;
+    xFD::Tuning().newton_div = 0;
+    Decimal p2 = x*y, s2 = x*x, r2, q2 = xFD::DivMod(z, y, r2);
+    xFD::Tuning() = saved;
+
+    BOOST_CHECK_EQUAL(p1.ToString(), p2.ToString());
+    BOOST_CHECK_EQUAL(s1.ToString(), s2.ToString());
+    BOOST_CHECK_EQUAL(q1.ToString(), q2.ToString());
+    BOOST_CHECK_EQUAL(r1.ToString(), r2.ToString());
+    BOOST_CHECK_EQUAL((q2*y + r2).ToString(), z.ToString());
+
+    // With the hardware and double-double tiers off the series give the
+    // same digits, and past their limits the tiers stay capped.
+    DecimalIterations its;
+    its.decimals = 15;
+    xFD::Tuning().hardware = 0;
+    xFD::Tuning().double_double = 0;
+    BOOST_CHECK_EQUAL(xFD::Pow("1.21423"_D(its)).ToString(), "3.367699936759362");
+    its.decimals = 30;
+    BOOST_CHECK_EQUAL(xFD::Ln(10_D(its)).ToString(), "2.302585092994045684017991454684");
+    xFD::Tuning().hardware = INT_MAX;
+    xFD::Tuning().double_double = INT_MAX;
+    its.decimals = 31;
+    BOOST_CHECK_EQUAL(xFD::Ln(10_D(its)).ToString(), "2.3025850929940456840179914546844");
+    xFD::Tuning() = saved;
+}
+
+BOOST_AUTO_TEST_CASE(LeadingDigits) {
+    // Reciprocals seeded from the leading digits, rounded to the precision
+    // even when the divisor or the dividend is large.
+    DecimalIterations its;
+    its.decimals = 18;
+    Decimal a = "-5670610127116.26639492"_D(its), b = "-62130792715636461.578536"_D(its);
+    BOOST_CHECK_EQUAL((a/b).ToString(), "0.000091268916414278");
+    its.decimals = 25;
+    a = "93169350956190240128317.7510622"_D(its);
+    b = "-9260724.6"_D(its);
+    BOOST_CHECK_EQUAL((a/b).ToString(), "-10060697729440117.4750750876515861404624861");
+
+    // Different decimals compare on the leading digits first.
+    BOOST_CHECK("0.0012"_D < "0.00120000001"_D);
+    BOOST_CHECK("123.45"_D > "123.4499999"_D);
+    BOOST_CHECK("-0.5"_D < "-0.49999"_D);
+    BOOST_CHECK("7.000"_D == "7.0"_D);
+}
+
+BOOST_AUTO_TEST_CASE(Logarithm) {
+    // Past the fast tiers, where Ln runs Halley steps on the series exp.
+    BOOST_CHECK_EQUAL(xFD::Ln(2_D).ToString(), "0.6931471805599453094172321214581765680755");
+    BOOST_CHECK_EQUAL(xFD::Ln(10_D).ToString(), "2.3025850929940456840179914546843642076011");
+    BOOST_CHECK_EQUAL(xFD::Ln("123456.789"_D).ToString(), "11.7236464871858809811399589839101115869104");
+    BOOST_CHECK_EQUAL(xFD::Ln("0.001"_D).ToString(), "-6.9077552789821370520539743640530926228033");
+    BOOST_CHECK_EQUAL(xFD::Log10(2_D).ToString(), "0.3010299956639811952137388947244930267682");
+    BOOST_CHECK_EQUAL(xFD::Log2(10_D).ToString(), "3.3219280948873623478703194294893901758648");
+    BOOST_CHECK_EQUAL(xFD::Pow(3_D, "-0.5"_D).ToString(), "0.5773502691896257645091487805019574556476");
+
+    DecimalIterations its;
+    its.decimals = 100;
+    BOOST_CHECK_EQUAL(xFD::Ln(10_D(its)).ToString(), "2.3025850929940456840179914546843642076011014886287729760333279009675726096773524802359972050895982983");
+    BOOST_CHECK_EQUAL(xFD::Pow("1.21423"_D(its)).ToString(), "3.3676999367593623344744380347388667711513618816183223322789211242371653465462559763448231483370871458");
+    BOOST_CHECK_EQUAL(xFD::Pow(2_D(its), "0.5"_D(its)).ToString(), "1.4142135623730950488016887242096980785696718753769480731766797379907324784621070388503875343276415727");
+    BOOST_CHECK_EQUAL(xFD::Pow("2.5"_D(its), "1.75"_D(its)).ToString(), "4.970442054794066657336672972667832688081618191552975364648941528583076318874855323878480057785182276");
+}
+
+BOOST_AUTO_TEST_CASE(Classification) {
+    BOOST_CHECK("0.000"_D.IsZero());
+    BOOST_CHECK((-0.0_D).IsZero());
+    BOOST_CHECK(!"0.001"_D.IsZero());
+    BOOST_CHECK(!Decimal().IsZero());
+    BOOST_CHECK("-0.001"_D.IsNegative());
+    BOOST_CHECK(!(-0.0_D).IsNegative());
+    BOOST_CHECK("1.000"_D.IsOne());
+    BOOST_CHECK(!"1.0001"_D.IsOne());
+    BOOST_CHECK(!(-1_D).IsOne());
+
+    BOOST_CHECK_EQUAL("15"_D.CompareSmall(15), 0);
+    BOOST_CHECK_EQUAL("15.01"_D.CompareSmall(15), 1);
+    BOOST_CHECK_EQUAL("-15.01"_D.CompareSmall(-15), -1);
+    BOOST_CHECK_EQUAL("-0.5"_D.CompareSmall(0), -1);
+    BOOST_CHECK_EQUAL("99999999999999999999999"_D.CompareSmall(LLONG_MAX), 1);
+    BOOST_CHECK_EQUAL("-9223372036854775808"_D.CompareSmall(LLONG_MIN), 0);
+    BOOST_CHECK_EQUAL(Decimal::Inf().CompareSmall(LLONG_MAX), 1);
+    BOOST_CHECK_THROW(Decimal().CompareSmall(0), DecimalIllegalOperation);
+}
+
+BOOST_AUTO_TEST_CASE(Literals) {
+    BOOST_CHECK_EQUAL((11.5_D).ToFixedString(), "+11.500000");
+    BOOST_CHECK_EQUAL((1e3_D).ToFixedString(), "+1000.000000");
+    BOOST_CHECK_EQUAL((1.5e-8_D).ToFixedString(), "+0.000000015");
+    BOOST_CHECK_EQUAL((.25_D).ToFixedString(), "+0.250000");
+    BOOST_CHECK_EQUAL((0x1F_D).ToString(), "31");
+    BOOST_CHECK_EQUAL((017_D).ToString(), "15");
+    BOOST_CHECK_EQUAL((18446744073709551615_D).ToString(), "18446744073709551615");
+    BOOST_CHECK_EQUAL((123456789012345678901234567890_D).ToString(), "123456789012345678901234567890");
+
+    // Every evaluation of a literal refers to the same Decimal.
+    const Decimal* first = nullptr;
+    for (int i = 0; i < 2; i++) {
+        const Decimal& two = 2_D;
+        if (first == nullptr)
+            first = &two;
+        BOOST_CHECK_EQUAL(first, &two);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MixedIntegers) {
+    Decimal a("12345678901234567890123456789.125");
+    BOOST_CHECK_EQUAL((a + 875).ToString(), "12345678901234567890123457664.125");
+    BOOST_CHECK_EQUAL((a - 790).ToString(), "12345678901234567890123455999.125");
+    BOOST_CHECK_EQUAL((a * -8).ToString(), "-98765431209876543120987654313");
+    BOOST_CHECK_EQUAL((a / 4).ToString(), "3086419725308641972530864197.28125");
+    BOOST_CHECK_EQUAL((1_D / 3).ToString(), "0.3333333333333333333333333333333333333333");
+    BOOST_CHECK_EQUAL((2_D / -3).ToString(), "-0.6666666666666666666666666666666666666667");
+    BOOST_CHECK_EQUAL(("-0.5"_D + 1).ToString(), "0.5");
+    BOOST_CHECK_EQUAL(("2.5"_D - 2.5).ToString(), "0");
+
+    // Increments carry and borrow through the integer digits in place.
+    Decimal b("999.75");
+    b++;
+    BOOST_CHECK_EQUAL(b.ToString(), "1000.75");
+    b = "-1000.5"_D;
+    --b;
+    BOOST_CHECK_EQUAL(b.ToString(), "-1001.5");
+    b = "-1000.5"_D;
+    ++b;
+    BOOST_CHECK_EQUAL(b.ToString(), "-999.5");
+    b = "-0.5"_D;
+    ++b;
+    BOOST_CHECK_EQUAL(b.ToString(), "0.5");
+
+    BOOST_CHECK("15"_D == 15);
+    BOOST_CHECK("15.5"_D > 15);
+    BOOST_CHECK("-15.5"_D < -15);
+    BOOST_CHECK("18446744073709551615"_D == ULONG_MAX);
+    BOOST_CHECK("18446744073709551616"_D > ULONG_MAX);
+    BOOST_CHECK(!(Decimal() == 0));
+    BOOST_CHECK_THROW(Decimal() < 0, DecimalIllegalOperation);
+}
+
+BOOST_AUTO_TEST_CASE(SignedAddition) {
+    // Past the native tier, with the scales aligned by offset.
+    Decimal a("123456789012345678901234567890123456789012.5");
+    Decimal b("-123456789012345678901234567890123456789012.50001");
+    BOOST_CHECK_EQUAL((a + b).ToString(), "-0.00001");
+    BOOST_CHECK_EQUAL((a - b).ToString(), "246913578024691357802469135780246913578025.00001");
+    Decimal c("-99999999999999999999999999999999999999999.999");
+    Decimal d("100000000000000000000000000000000000000000");
+    BOOST_CHECK_EQUAL((c + d).ToString(), "0.001");
+    BOOST_CHECK_EQUAL((d - c).ToString(), "199999999999999999999999999999999999999999.999");
+    BOOST_CHECK_EQUAL((a - a).ToFixedString(), "+0");
+    BOOST_CHECK_EQUAL((c + (-c)).ToFixedString(), "+0");
+
+    // An exact zero keeps the operands' precision and error mode.
+    DecimalIterations its;
+    its.decimals = 80;
+    its.throw_on_error = false;
+    Decimal e = a(its);
+    Decimal z = e - e;
+    BOOST_CHECK(z.IsZero());
+    BOOST_CHECK_EQUAL(z.GetIterations().decimals, 80);
+    BOOST_CHECK(!z.GetIterations().TOE());
+    BOOST_CHECK_EQUAL((z + e).GetIterations().decimals, 80);
+
+    // The same under 38 digits, where the native tier takes the sum.
+    Decimal m = Decimal("1.5")(its);
+    Decimal w = m - m;
+    BOOST_CHECK(w.IsZero());
+    BOOST_CHECK_EQUAL(w.GetIterations().decimals, 80);
+    BOOST_CHECK(!w.GetIterations().TOE());
+    BOOST_CHECK_NO_THROW(w / w);
+    BOOST_CHECK((m + (-m)).IsZero());
+    BOOST_CHECK_EQUAL((m + (-m)).GetIterations().decimals, 80);
+}
+
+BOOST_AUTO_TEST_CASE(PowerOfTenScaling) {
+    Decimal bp("12.5");
+    BOOST_CHECK_EQUAL(xFD::ScaleB10(bp, -4).ToString(), "0.00125");
+    BOOST_CHECK_EQUAL(xFD::ScaleB10(bp, 1).ToString(), "125");
+    BOOST_CHECK_EQUAL(xFD::ScaleB10(bp, 3).ToString(), "12500");
+    BOOST_CHECK_EQUAL(xFD::ScaleB10(Decimal("-0.0042"), 3).ToString(), "-4.2");
+    BOOST_CHECK_EQUAL(xFD::ScaleB10(Decimal("-0.0042"), 4).ToString(), "-42");
+
+    // The scale moves and the digits stay, trailing zeros included.
+    Decimal cents("1999.00");
+    cents.ShiftDecimalPoint(2);
+    BOOST_CHECK_EQUAL(cents.ToFixedString(), "+199900");
+    cents.ShiftDecimalPoint(-2);
+    BOOST_CHECK_EQUAL(cents.ToFixedString(), "+1999.00");
+    cents.ShiftDecimalPoint(-45);
+    BOOST_CHECK_EQUAL(cents.Decimals(), 47);
+    BOOST_CHECK_GE(cents.GetIterations().decimals, 47);
+    BOOST_CHECK(xFD::ScaleB10(cents, 45) == Decimal("1999"));
+    BOOST_CHECK(xFD::ScaleB10(xFD::Inf(), 3).IsInf());
+}
+
+BOOST_AUTO_TEST_CASE(BinarySplitting) {
+    // sum 1/2^n over 10 terms is 2 - 1/2^9.
+    xFDSeries halves([](unsigned long) { return xFDInt(1); },
+                     [](unsigned long n) { return xFDInt(n == 0 ? 1 : 2); },
+                     [](unsigned long) { return xFDInt(1); });
+    xFDSeries::Split s = halves.Evaluate(0, 10);
+    BOOST_CHECK_EQUAL(s.Q, xFDInt(512));
+    BOOST_CHECK_EQUAL(s.T, xFDInt(1023));
+    BOOST_CHECK_EQUAL(halves.Sum(10), "1.998046875"_D);
+    BOOST_CHECK_THROW(halves.Evaluate(3, 3), DecimalIllegalOperation);
+
+    DecimalIterations its;
+    its.decimals = 60;
+    xFDSeries e([](unsigned long) { return xFDInt(1); },
+                [](unsigned long n) { return xFDInt(n == 0 ? 1 : static_cast<long long>(n)); },
+                [](unsigned long) { return xFDInt(1); });
+    BOOST_CHECK_EQUAL(e.Sum(60, its).ToString(), "2.718281828459045235360287471352662497757247093699959574966968");
+}
+
+BOOST_AUTO_TEST_CASE(Constants) {
+    BOOST_CHECK_EQUAL(xFDCon::Pi().ToString(), "3.1415926535897932384626433832795028841972");
+    BOOST_CHECK_EQUAL(xFDCon::_1Pi().ToString(), "0.3183098861837906715377675267450287240689");
+    BOOST_CHECK_EQUAL(xFDCon::Pi4().ToString(), "0.7853981633974483096156608458198757210493");
+    BOOST_CHECK_EQUAL(xFDCon::E().ToString(), "2.7182818284590452353602874713526624977572");
+    BOOST_CHECK_EQUAL(xFDCon::Ln2().ToString(), "0.6931471805599453094172321214581765680755");
+    BOOST_CHECK_EQUAL(xFDCon::Sqrt2().ToString(), "1.4142135623730950488016887242096980785697");
+
+    DecimalIterations its;
+    its.decimals = 100;
+    DecimalConstants c(its);
+    BOOST_CHECK_EQUAL(c.pPi.ToString(), "3.1415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170680");
+    BOOST_CHECK_EQUAL(c.pLn10.ToString(), "2.3025850929940456840179914546843642076011014886287729760333279009675726096773524802359972050895982983");
+    BOOST_CHECK_EQUAL(c.p_2SqrtPi.ToString(), "1.1283791670955125738961589031215451716881012586579977136881714434212849368829868289734873204042147269");
+
+    // Lower precisions are rounded from the entry above.
+    its.decimals = 30;
+    BOOST_CHECK_EQUAL(xFDCon::Ln10(its).ToString(), "2.302585092994045684017991454684");
+    BOOST_CHECK_EQUAL(xFDCon::Pi(its).GetIterations().decimals, 30);
+    its.decimals = 20;
+    BOOST_CHECK_EQUAL(xFDCon::Pi2(its).ToString(), "1.57079632679489661923");
+}
+
+BOOST_AUTO_TEST_CASE(ConstantTables) {
+    // Served from the embedded digits, then from the series past them.
+    DecimalIterations its;
+    its.decimals = 4000;
+    Decimal pi = xFDCon::Pi(its), ln2 = xFDCon::Ln2(its);
+    BOOST_CHECK_EQUAL(pi.ToString().substr(3980), "6201052652272111660397");
+    its.decimals = 6000;
+    Decimal computed = xFDCon::Pi(its);
+    computed.RoundTo(4000);
+    BOOST_CHECK_EQUAL(pi, computed);
+    computed = xFDCon::Ln2(its);
+    computed.RoundTo(4000);
+    BOOST_CHECK_EQUAL(ln2, computed);
+
+    // Past the tables, a lower precision is cut from the cached entry and
+    // rounded once.
+    its.decimals = 5050;
+    std::string pi5050 = xFDCon::Pi(its).ToString();
+    BOOST_CHECK_EQUAL(pi5050.size(), 5052u);
+    BOOST_CHECK_EQUAL(pi5050.substr(5027), "8193195167353812974167729");
+}
+
+BOOST_AUTO_TEST_CASE(ConstantStore) {
+    const char* path = "test_constants.store";
+    std::remove(path);
+    DecimalIterations its;
+    its.decimals = 5100;
+    xFDCon::ClearCache();
+    xFDCon::SetStore(path);
+    Decimal e = xFDCon::E(its);
+
+    std::ifstream in(path, std::ios::binary);
+    std::string file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    BOOST_REQUIRE_GT(file.size(), 5100u);
+    BOOST_CHECK_EQUAL(file.substr(0, 8), "xFDCONST");
+
+    // Served from the file, then recomputed once its digits are damaged.
+    xFDCon::ClearCache();
+    BOOST_CHECK_EQUAL(xFDCon::E(its), e);
+    std::string damaged = file;
+    damaged[file.size() - 10] = (file[file.size() - 10] == '1') ? '2' : '1';
+    std::ofstream(path, std::ios::binary) << damaged;
+    xFDCon::ClearCache();
+    BOOST_CHECK_EQUAL(xFDCon::E(its), e);
+    in.open(path, std::ios::binary);
+    BOOST_CHECK(std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>()) == file);
+    in.close();
+
+    // A damaged entry is dropped when another constant is written.
+    std::ofstream(path, std::ios::binary) << damaged;
+    xFDCon::ClearCache();
+    xFDCon::Pi(its);
+    in.open(path, std::ios::binary);
+    std::string saved((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    BOOST_CHECK_GT(saved.size(), 5100u);
+    BOOST_CHECK(saved.find(damaged.substr(file.size() - 40)) == std::string::npos);
+
+    xFDCon::SetStore("");
+    std::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(StatusFlags) {
+    Decimal::ClearStatus();
+    Decimal one = 1_D, zero = 0_D;
+    one.SetThrowOnError(false);
+    zero.SetThrowOnError(false);
+    BOOST_CHECK((one / zero).IsInf());
+    BOOST_CHECK(Decimal::TestStatus(Decimal::STATUS_DIVISION_BY_ZERO));
+    BOOST_CHECK(!Decimal::TestStatus(Decimal::STATUS_INVALID));
+    BOOST_CHECK((zero / zero).IsNaN());
+    BOOST_CHECK(xFD::Sqrt(-one).IsNaN());
+    BOOST_CHECK(xFD::Ln(-one).IsNaN());
+    BOOST_CHECK(Decimal::TestStatus(Decimal::STATUS_INVALID));
+    Decimal::ClearStatus(Decimal::STATUS_INVALID | Decimal::STATUS_DIVISION_BY_ZERO);
+    BOOST_CHECK_EQUAL(Decimal::GetStatus(), 0u);
+
+    // The logarithm of zero is a pole, at every precision.
+    Decimal ln0 = xFD::Ln(zero);
+    BOOST_CHECK(ln0.IsInf());
+    BOOST_CHECK(ln0.IsNegative());
+    BOOST_CHECK_EQUAL(Decimal::GetStatus(), static_cast<unsigned>(Decimal::STATUS_DIVISION_BY_ZERO));
+    BOOST_CHECK_THROW(xFD::Ln(0_D), DecimalIllegalOperation);
+    BOOST_CHECK_THROW(xFD::Ln(0_D(DecimalIterations())), DecimalIllegalOperation);
+    Decimal::ClearStatus();
+
+    // Exact quotients stay exact on every division path.
+    Decimal big("12345678901234567890123456789012345678901234");
+    BOOST_CHECK_EQUAL((big / 2_D).ToString(), "6172839450617283945061728394506172839450617");
+    BOOST_CHECK_EQUAL((one / 4).ToString(), "0.25");
+    BOOST_CHECK_EQUAL(xFD::Sqrt(Decimal("2.25")).ToString(), "1.5");
+    BOOST_CHECK(!Decimal::TestStatus(Decimal::STATUS_INEXACT));
+    BOOST_CHECK_EQUAL((big / 1024_D).ToString(), "12056327051986882705198688270519868827051.986328125");
+    BOOST_CHECK_EQUAL((big / "0.125"_D).ToString(), "98765431209876543120987654312098765431209872");
+    BOOST_CHECK(!Decimal::TestStatus(Decimal::STATUS_INEXACT));
+    big / 3_D;
+    BOOST_CHECK(Decimal::TestStatus(Decimal::STATUS_INEXACT));
+    Decimal::ClearStatus();
+    // The guard digits of this one read 05, as an exact quotient's could.
+    BOOST_CHECK_EQUAL((big / 34_D).ToString(), "363108202977487290885984023206245461144153.9411764705882352941176470588235294117647");
+    BOOST_CHECK(Decimal::TestStatus(Decimal::STATUS_INEXACT));
+    Decimal::ClearStatus();
+
+    // Conversions saturate, or truncate a fraction.
+    Decimal wide("300"), frac("-2.75");
+    wide.SetThrowOnError(false);
+    frac.SetThrowOnError(false);
+    BOOST_CHECK_EQUAL(static_cast<int>(wide.ToChar8()), 127);
+    BOOST_CHECK_EQUAL((-wide).ToUInt32(), 0u);
+    BOOST_CHECK(Decimal::TestStatus(Decimal::STATUS_OVERFLOW));
+    BOOST_CHECK_EQUAL(frac.ToInt32(), -2);
+    BOOST_CHECK(Decimal::TestStatus(Decimal::STATUS_INEXACT));
+
+    // Throwing still raises the flag.
+    Decimal::ClearStatus();
+    BOOST_CHECK_THROW(1_D / 0_D, DecimalIllegalOperation);
+    BOOST_CHECK_EQUAL(Decimal::GetStatus(), static_cast<unsigned>(Decimal::STATUS_DIVISION_BY_ZERO));
+    Decimal::ClearStatus();
+}
+
 BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,76 @@
+#include "types/Decimal.h"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Writes the digit tables that libxFD serves the constants from, so that
+// only precisions past them run the series. Usage: digits places [output]
+// The places are required, so that a bare run can't shrink the tables;
+// `make tables` passes the size the library ships with.
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " places [output]" << std::endl;
+        return 1;
+    }
+    int places = std::atoi(argv[1]);
+    std::string path = (argc > 2) ? argv[2] : "src/DecimalDigits.h";
+    if (places < 1) {
+        std::cerr << "Places must be positive" << std::endl;
+        return 1;
+    }
+
+    // Past the current tables so that the series run, then cut back to an
+    // exact prefix of each expansion.
+    DecimalIterations its;
+    its.decimals = places + 10;
+    struct {
+        const char* name;
+        Decimal (*get)(const DecimalIterations&);
+    } constants[] = {
+        // Same order as DecimalConstants::Constant.
+        {"e", xFDCon::E},
+        {"Pi", xFDCon::Pi},
+        {"1/Pi", xFDCon::_1Pi},
+        {"Pi/2", xFDCon::Pi2},
+        {"Pi/4", xFDCon::Pi4},
+        {"ln(2)", xFDCon::Ln2},
+        {"ln(10)", xFDCon::Ln10},
+        {"2/Pi", xFDCon::_2Pi},
+        {"2/sqrt(Pi)", xFDCon::_2SqrtPi},
+        {"Log2(e)", xFDCon::Log2E},
+        {"Log10(e)", xFDCon::Log10E},
+        {"sqrt(2)", xFDCon::Sqrt2},
+        {"1/sqrt(2)", xFDCon::_1Sqrt2},
+    };
+
+    std::ofstream out(path.c_str());
+    if (!out) {
+        std::cerr << "Cannot write " << path << std::endl;
+        return 1;
+    }
+    out << "// Generated by digits, do not edit.\n"
+        << "#define DECIMAL_DIGITS_PLACES " << places << "\n\n"
+        << "static const char* const DECIMAL_DIGITS[] = {\n";
+    for (const auto& c : constants) {
+        Decimal x = c.get(its);
+        x.RoundTo(places, xFD::ROUND_DOWN);
+        std::string s = x.ToFixedString();
+        if (s[0] == '+')
+            s.erase(0, 1);
+        // The fraction lost its trailing zeros, the table keeps them.
+        size_t point = s.find('.');
+        if (point == std::string::npos) {
+            point = s.size();
+            s += '.';
+        }
+        s.append(point + 1 + places - s.size(), '0');
+        out << "    // " << c.name << "\n";
+        for (size_t i = 0; i < s.size(); i += 100)
+            out << "    \"" << s.substr(i, 100) << "\"" << ((i + 100 < s.size()) ? "\n" : ",\n");
+    }
+    out << "};\n";
+    std::cout << "Wrote " << path << std::endl;
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "types/Decimal.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Measures the kernel crossovers on this host and writes them as a header
+// that the library includes in HAVE_DECIMAL_TUNING builds.
+// Usage: tune [output header]
+
+static std::mt19937_64 rng(1);
+
+static Decimal RandomInt(int digits) {
+    std::string s(1, static_cast<char>('1' + rng() % 9));
+    for (int i = 1; i < digits; i++)
+        s += static_cast<char>('0' + rng() % 10);
+    return Decimal(s);
+}
+
+// Best of three runs, each repeated until it lasts a few milliseconds.
+template <typename F>
+static double Time(F f) {
+    double best = 1e30;
+    for (int run = 0; run < 3; run++) {
+        int reps = 0;
+        auto start = std::chrono::steady_clock::now();
+        double elapsed;
+        do {
+            f();
+            reps++;
+            elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        } while (elapsed < 0.005);
+        best = std::min(best, elapsed / reps);
+    }
+    return best;
+}
+
+// First size at which the fast kernel wins there and at the next size up,
+// so that noise on a single size doesn't set the crossover.
+template <typename F>
+static int Crossover(const std::vector<int>& sizes, int& knob, F run) {
+    bool won = false;
+    for (size_t i = 0; i < sizes.size(); i++) {
+        knob = INT_MAX;
+        double slow = Time([&] { run(sizes[i]); });
+        knob = sizes[i];
+        double fast = Time([&] { run(sizes[i]); });
+        std::cout << "  " << sizes[i] << " digits: " << slow * 1e6 << "us -> " << fast * 1e6 << "us" << std::endl;
+        if (fast < slow) {
+            if (won)
+                return sizes[i - 1];
+            won = true;
+        }
+        else {
+            won = false;
+        }
+    }
+    return won ? sizes.back() : INT_MAX / 2;
+}
+
+int main(int argc, char* argv[]) {
+    std::string path = (argc > 1) ? argv[1] : "src/DecimalTuning.h";
+    DecimalTuning& tuning = xFD::Tuning();
+
+    // One level of Karatsuba against the schoolbook product.
+    std::cout << "Karatsuba multiplication" << std::endl;
+    tuning.newton_div = INT_MAX;
+    int karatsuba = Crossover({16, 24, 32, 48, 64, 96, 128, 192, 256, 384, 512}, tuning.karatsuba, [](int n) {
+        static Decimal x, y;
+        if (static_cast<int>(x.Ints()) != n) {
+            x = RandomInt(n);
+            y = RandomInt(n);
+        }
+        Decimal p = x * y;
+    });
+    tuning.karatsuba = karatsuba;
+
+    // A 2n by n digit division, long against Newton.
+    std::cout << "Newton division" << std::endl;
+    int newton_div = Crossover({64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048}, tuning.newton_div, [](int n) {
+        static Decimal x, y;
+        if (static_cast<int>(y.Ints()) != n) {
+            x = RandomInt(2*n);
+            y = RandomInt(n);
+        }
+        Decimal r;
+        xFD::DivMod(x, y, r);
+    });
+
+    std::ofstream out(path.c_str());
+    if (!out) {
+        std::cerr << "Cannot write " << path << std::endl;
+        return 1;
+    }
+    out << "// Generated by tune, do not edit.\n"
+        << "#define DECIMAL_KARATSUBA_DIGITS " << karatsuba << "\n"
+        << "#define DECIMAL_NEWTON_DIV_DIGITS " << newton_div << "\n";
+    std::cout << "Wrote " << path << std::endl;
+    return 0;
+}